@@ -1,3 +1,6 @@
+#include <stddef.h>
+#include <avr/pgmspace.h>
+
 #include "hwbp_core.h"
 #include "hwbp_core_regs.h"
 #include "hwbp_core_types.h"
@@ -7,6 +10,20 @@
 #include "app_ios_and_regs.h"
 
 #include "uart0.h"
+#include "u64_handoff.h"
+#include "detection_log.h"
+#include "config_image.h"
+#include "reader_protocol.h"
+#include "wiegand.h"
+#include "reader.h"
+#include "stats.h"
+#include "latency.h"
+#include "rules.h"
+#include "out0_gate.h"
+#include "work.h"
+#include "self_test.h"
+#include "sequencer.h"
+#include "handler_time.h"
 
 /************************************************************************/
 /* Declare application registers                                        */
@@ -15,14 +32,23 @@ extern AppRegs app_regs;
 extern uint8_t app_regs_type[];
 extern uint16_t app_regs_n_elements[];
 extern uint8_t *app_regs_pointer[];
-extern void (*app_func_rd_pointer[])(void);
-extern bool (*app_func_wr_pointer[])(void*);
+extern const uint16_t app_regs_min[] PROGMEM;
+extern const uint16_t app_regs_max[] PROGMEM;
+extern void (* const app_func_rd_pointer[])(void) PROGMEM;
+extern bool (* const app_func_wr_pointer[])(void*) PROGMEM;
+
+/* Read the handlers from flash */
+#define app_func_rd(index) ((void (*)(void))pgm_read_word(&app_func_rd_pointer[index]))
+#define app_func_wr(index) ((bool (*)(void*))pgm_read_word(&app_func_wr_pointer[index]))
 
 /************************************************************************/
 /* Initialize app                                                       */
 /************************************************************************/
 static const uint8_t default_device_name[] = "RfidReader";
 
+/* The rest of the bank would overwrite the configuration image */
+_Static_assert(APP_NBYTES_TO_SAVE == offsetof(AppRegs, REG_DETECTION_LOG_CONFIG), "APP_NBYTES_TO_SAVE");
+
 void hwbp_app_initialize(void)
 {
     /* Define versions */
@@ -39,7 +65,7 @@ void hwbp_app_initialize(void)
         fwH, fwL,
         ass,
         (uint8_t*)(&app_regs),
-        APP_NBYTES_OF_REG_BANK,
+        APP_NBYTES_TO_SAVE,
         APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1,
         default_device_name,
         false,	// The device is not able to repeat the harp timestamp clock
@@ -65,6 +91,27 @@ void core_callback_catastrophic_error_detected(void)
 /************************************************************************/
 /* Add your functions here or load external functions if needed */
 
+/* Read the harp timestamp without touching the core's user timestamp, */
+/* so it can be used from interrupts that preempt the core             */
+void capture_timestamp(volatile timestamp_t *timestamp)
+{
+	uint32_t second;
+	
+	do
+	{
+		second = core_func_read_R_TIMESTAMP_SECOND();
+		timestamp->usecond = core_func_read_R_TIMESTAMP_MICRO();
+		timestamp->second = second;
+	} while (second != core_func_read_R_TIMESTAMP_SECOND());
+}
+
+/* Send an event stamped with a previously captured timestamp */
+void send_event_at(uint8_t add, timestamp_t *timestamp)
+{
+	core_func_update_user_timestamp(timestamp->second, timestamp->usecond);
+	core_func_send_event(add, false);
+}
+
 /************************************************************************/
 /* Initialization Callbacks                                             */
 /************************************************************************/
@@ -80,8 +127,13 @@ void core_callback_initialize_hardware(void)
 	init_ios();
 	
 	/* Initialize hardware */
-	uart0_init(12, 4, false);   // 1 Mb/s
+	uart0_init(12, 4, false);   // The baud rate is set by reader_init()
 	uart0_enable();
+	reader_init();
+	handler_time_start_timer();
+	
+	/* Find the detection log on the EEPROM */
+	detection_log_init();
 }
 
 void core_callback_reset_registers(void)
@@ -103,12 +155,76 @@ void core_callback_reset_registers(void)
 	app_regs.REG_TAG_MATCH2_OUT0_PERIOD = 0;
 	app_regs.REG_TAG_MATCH3_OUT0_PERIOD = 0;
 	app_regs.REG_TAG_ID_ARRIVED_PERIOD = 0;
+	app_regs.REG_DETECTION_LOG_CONFIG = 0;
+	app_regs.REG_CONFIG_IMAGE = 0;
+	app_regs.REG_RAW_FRAME_CONFIG = 0;
+	app_regs.REG_READER_PROTOCOLS = (1 << PROTOCOL_COUNT) - 1;	// All protocols
+	app_regs.REG_READER_INTERFACE = GM_READER_ASCII;
+	app_regs.REG_EVENT_CONFIG = 0;
+	app_regs.REG_STATS_CONFIG = 0;
+	app_regs.REG_TAG_PRESENT_OUT0_PERIOD = 0;
+	app_regs.REG_TAG_PRESENT_NOTIFICATIONS = 0;
+	app_regs.REG_OUT0_GATE = 0;
+	app_regs.REG_OUT0_GATE_PULSE = 10;
+	app_regs.REG_OUT0_GATE_HOLDOFF = 0;
+	app_regs.REG_TAG_IN_RANGE_FILTER[0] = 0;
+	app_regs.REG_TAG_IN_RANGE_FILTER[1] = 0;
+	app_regs.REG_TAG_IN_RANGE_GLITCHES = 0;
+	app_regs.REG_WORK_QUEUE[WORK_MAX_DEPTH] = 0;
+	app_regs.REG_WORK_QUEUE[WORK_WORST_WAIT] = 0;
+	app_regs.REG_WORK_QUEUE[WORK_DROPPED] = 0;
+	app_regs.REG_SELF_TEST = 0;
+	app_regs.REG_READER_BAUD_RATE = GM_BAUD_9600;
+	app_regs.REG_FRAME_TIMING[0] = 0;
+	app_regs.REG_FRAME_TIMING[1] = 0;
+	app_regs.REG_FRAME_TIMING[2] = 0;
+	for (uint8_t i = 0; i < sizeof(app_regs.REG_USER_PATTERN); i++)
+		app_regs.REG_USER_PATTERN[i] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_FPS] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_DROPPED] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_OVERRUNS] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_BYTE_PERIOD] = 0;
+	
+	for (uint8_t i = 0; i < sizeof(app_regs.REG_MATCH_TABLE); i++)
+		app_regs.REG_MATCH_TABLE[i] = 0;
+	
+	for (uint8_t i = 0; i < sizeof(app_regs.REG_RULES); i++)
+		app_regs.REG_RULES[i] = 0;
+	
+	for (uint8_t i = 0; i < MATCH_TABLE_SIZE; i++)
+		app_regs.REG_SUPPRESSED_ACTIVATIONS[i] = 0;
+	
+	latency_reset();
 }
 
+extern void reset_match_limits(void);
+
+/* A reset from the host, to the defaults or to the core's EEPROM, keeps its registers */
+static bool is_booting = true;
+
 void core_callback_registers_were_reinitialized(void)
 {
 	/* Update registers if needed */
-	app_write_REG_BUZZER_FREQUENCY(&app_regs.REG_BUZZER_FREQUENCY);
+	/* At boot, replace the registers with the configuration image, if there's a valid one */
+	if (is_booting)
+	{
+		is_booting = false;
+		config_image_load();
+	}
+	
+	reset_match_limits();
+	
+	/* The write goes through the range check because the content may come from the EEPROM */
+	if (!core_write_app_register(ADD_REG_BUZZER_FREQUENCY, TYPE_U16, (uint8_t*)(&app_regs.REG_BUZZER_FREQUENCY), 1))
+	{
+		app_regs.REG_BUZZER_FREQUENCY = 1000;		// 1 KHz
+		app_write_REG_BUZZER_FREQUENCY(&app_regs.REG_BUZZER_FREQUENCY);
+	}
+	
+	app_write_REG_READER_INTERFACE(&app_regs.REG_READER_INTERFACE);
+	app_write_REG_READER_BAUD_RATE(&app_regs.REG_READER_BAUD_RATE);
+	app_write_REG_OUT0_GATE(&app_regs.REG_OUT0_GATE);
+	app_write_REG_TAG_IN_RANGE_FILTER(app_regs.REG_TAG_IN_RANGE_FILTER);
 	
 }
 
@@ -132,9 +248,6 @@ void core_callback_visualen_to_off(void)
 /************************************************************************/
 /* Serial RX                                                            */
 /************************************************************************/
-uint8_t rxbuff_pointer = 0;
-extern uint8_t rxbuff_uart0[];
-
 uint16_t out0_timeout_ms = 0;
 
 /*
@@ -165,14 +278,28 @@ bool stop_buzzer;
 extern uint8_t buzzer_prescaler;
 extern uint16_t buzzer_target_count;
 
-bool id_event_was_sent = false;
+/* Written by the interrupts and read by the register callbacks */
+u64_handoff_t tag_id_arrived;
+u64_handoff_t tag_id_leaved;
 
 void notify(uint8_t notify_mask)
 {
+	/* A pattern replaces the other bits, unless it's empty */
+	if ((notify_mask & GM_PATTERN) && sequencer_play(((notify_mask & GM_PATTERN) >> 4) - 1))
+	{
+		buzzer_time_on = 0;
+		top_led_time_on = 0;
+		bottom_led_time_on = 0;
+		return;
+	}
+	
+	if (notify_mask & (B_BUZZER | B_TOP_LED | B_BOTTOM_LED))
+		sequencer_stop();
+	
 	if ((notify_mask & B_BUZZER) && (app_regs.REG_TIME_ON_BUZZER > 1))
 	{
 		// Replace with timer TCD0 on several places -- do a search
-		timer_type0_pwm(&TCC0, buzzer_prescaler, buzzer_target_count, buzzer_target_count>>1, INT_LEVEL_LOW, INT_LEVEL_LOW);
+		timer_type0_pwm(&TCC0, buzzer_prescaler, buzzer_target_count, buzzer_target_count>>1, BUZZER_INT_LEVEL, BUZZER_INT_LEVEL);
 		buzzer_time_on = app_regs.REG_TIME_ON_BUZZER;
 		stop_buzzer = false;
 	}
@@ -197,16 +324,19 @@ void notify(uint8_t notify_mask)
 
 void uart0_rcv_byte_callback(uint8_t byte_received)
 {
-	if (rxbuff_pointer == 0)
-	{
-		timer_type1_enable(&TCD1, TIMER_PRESCALER_DIV1024, 156, INT_LEVEL_LOW);		// ~5 ms
-																											// 1 byte = 833 us @ 9600bps
-		id_event_was_sent = false;
-		app_regs.REG_TAG_ID_ARRIVED = 0;
-	}
+	uint16_t start = handler_time_start();
+	
+	reader_rcv_byte(&readers[0], byte_received);
+	handler_time_stop(HANDLER_MED, start);
+}
+
+/* Wiegand is read by the first reader's module */
+void wiegand_rcv_bit_callback(bool bit)
+{
+	uint16_t start = handler_time_start();
 	
-	rxbuff_uart0[rxbuff_pointer++] = byte_received;
-	TCD1_CNT = 0;
+	reader_rcv_bit(&readers[0], bit);
+	handler_time_stop(HANDLER_MED, start);
 }
 
 
@@ -224,11 +354,55 @@ void core_callback_device_to_speed(void) {}
 /************************************************************************/
 void core_callback_t_before_exec(void) {}
 void core_callback_t_after_exec(void) {}
-void core_callback_t_new_second(void) {}
+extern void match_limits_new_second(void);
+
+void core_callback_t_new_second(void)
+{
+	rules_new_second();
+	match_limits_new_second();
+	stats_new_second(app_regs.REG_STATS);
+	
+	if (app_regs.REG_STATS_CONFIG & B_STATS_EN)
+		core_func_send_event(ADD_REG_STATS, true);
+}
 void core_callback_t_500us(void) {}
+extern volatile bool tag_left_range;
+extern volatile bool tag_entered_range;
+
 void core_callback_t_1ms(void)
 {
-	if (out0_timeout_ms)
+	uint16_t start = handler_time_start();
+	
+	/* The TAG_IN_RANGE interrupt only flags the edges, kept until there's room on the queue */
+	if (tag_entered_range && work_alloc(WORK_TAG_ENTERED, 0))
+	{
+		tag_entered_range = false;
+		work_push();
+	}
+	
+	if (tag_left_range && work_alloc(WORK_TAG_LEFT, 0))
+	{
+		tag_left_range = false;
+		work_push();
+	}
+	
+	/* Time with a tag in range */
+	stats_tick_1ms(read_TAG_IN_RANGE);
+	reader_tick_1ms();
+	self_test_tick_1ms();
+	sequencer_tick_1ms();
+	
+	/* Write the detection log and the configuration image to the EEPROM */
+	detection_log_task();
+	config_image_task();
+	
+	/* The gate owns OUT0 while enabled */
+	if (out0_gate_is_enabled())
+	{
+		out0_timeout_ms = 0;
+		out0_gate_tick_1ms();
+	}
+	else if (out0_timeout_ms)
 	{
 		if (!read_OUT0)
 		{
@@ -242,6 +416,9 @@ void core_callback_t_1ms(void)
 			core_func_send_event(ADD_REG_OUT, true);
 		}
 		
+		/* OUT0 is asserted, or still is from the previous detection */
+		latency_out0();
+		
 		out0_timeout_ms--;
 		
 		if (out0_timeout_ms == 0)
@@ -292,6 +469,8 @@ void core_callback_t_1ms(void)
 			clr_LED_DETECT_BOTTOM;
 		}
 	}
+	
+	handler_time_stop(HANDLER_LOW, start);
 }
 
 /************************************************************************/
@@ -326,7 +505,7 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 		return false;
 	
 	/* Receive data */
-	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+	(*app_func_rd(add-APP_REGS_ADD_MIN))();
 
 	/* Return success */
 	return true;
@@ -335,6 +514,31 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 /************************************************************************/
 /* Callbacks: Write app register                                        */
 /************************************************************************/
+bool app_regs_content_is_in_range(uint8_t index, uint8_t type, uint8_t * content, uint16_t n_elements)
+{
+	uint16_t min = pgm_read_word(&app_regs_min[index]);
+	uint16_t max = pgm_read_word(&app_regs_max[index]);
+	uint16_t value;
+	
+	if (min == 0 && max == 0xFFFF)
+		return true;
+	
+	for (uint16_t i = 0; i < n_elements; i++)
+	{
+		if (type == TYPE_U8)
+			value = content[i];
+		else if (type == TYPE_U16)
+			value = ((uint16_t*)content)[i];
+		else
+			return true;
+		
+		if (value < min || value > max)
+			return false;
+	}
+	
+	return true;
+}
+
 bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint16_t n_elements)
 {
 	/* Check if it will not access forbidden memory */
@@ -348,7 +552,11 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 	/* Check if the number of elements matches */
 	if (app_regs_n_elements[add-APP_REGS_ADD_MIN] != n_elements)
 		return false;
+	
+	/* Check if the content is inside the register's range */
+	if (!app_regs_content_is_in_range(add-APP_REGS_ADD_MIN, type, content, n_elements))
+		return false;
 
 	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	return (*app_func_wr(add-APP_REGS_ADD_MIN))(content);
 }
\ No newline at end of file
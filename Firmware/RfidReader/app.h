@@ -9,6 +9,103 @@
 #define hwbp_app_enable_interrupts 	PMIC_CTRL = PMIC_CTRL | PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm; __asm volatile("sei");
 
 
+/************************************************************************/
+/* Interrupt priorities                                                 */
+/*                                                                      */
+/* HIGH: TAG_IN_RANGE edges, only capture the timestamp (~4 us)         */
+/*       and their glitch filter's timer, which confirms the edge       */
+/* MED:  Reader's RX, only store the byte and restart the timeout (~2us)*/
+/*       plus the first byte's timestamp if raw frames are enabled      */
+/*       or the Wiegand input's edges, one bit each                     */
+/* LOW:  Frame timeout (take the frame and queue it), the buzzer and    */
+/*       the core's 1 ms tick, which never preempt each other           */
+/* Main loop: decode, match, events, notify (see work.h), with the LOW  */
+/*       level masked except while decoding                             */
+/*                                                                      */
+/* Worst case latency budget @ 32 MHz                                   */
+/* The longest handler of each level is measured on the device and    */
+/* read from REG_HANDLER_TIMES (0.25 us, Out0Gate disabled). The times  */
+/* below are the limits each one must stay under and the estimates from */
+/* the code until they are read from a board.                           */
+/* HIGH: REG_HANDLER_TIMES[0], the core's sections that mask the HIGH   */
+/*       level (~20 us estimated)                                       */
+/* MED:  REG_HANDLER_TIMES[1], HIGH work included (~30 us estimated),   */
+/*       must stay below 2 bytes of the reader's UART (174 us @ 115200) */
+/*       so the 2 bytes FIFO never overruns                             */
+/* LOW:  REG_HANDLER_TIMES[2], the 1 ms tick, as the frame timeouts     */
+/*       only take the frame or hold it on the reader's buffer          */
+/************************************************************************/
+#define TAG_IN_RANGE_INT_LEVEL      INT_LEVEL_HIGH
+#define TAG_IN_RANGE_FILTER_TIMER   TCE0        // Same level, 32 us per tick
+#define FRAME_TIMEOUT_INT_LEVEL     INT_LEVEL_LOW
+#define BUZZER_INT_LEVEL            INT_LEVEL_LOW
+
+
+/************************************************************************/
+/* Match table                                                          */
+/*                                                                      */
+/* Content of REG_MATCH_TABLE, written in a single message. An entry    */
+/* with tag_id = 0 is not used.                                         */
+/*                                                                      */
+/* The activations (OUT0 pulse and notifications) of each entry can be  */
+/* limited by a refractory time and a quota per window. The window      */
+/* starts on the first activation after the previous one is over. The   */
+/* activations suppressed are counted on REG_SUPPRESSED_ACTIVATIONS,    */
+/* the detection events are still sent.                                 */
+/*                                                                      */
+/* The limits are checked against the detection's Harp time and apply   */
+/* only to the table, not to REG_TAG_MATCHx. Their state is kept apart, */
+/* cleared when the table is written.                                   */
+/************************************************************************/
+/* The configuration image and the SRAM have no room for more entries */
+#define MATCH_TABLE_SIZE            2
+
+/* Matching IDs are indexed 0 to 3 for REG_TAG_MATCHx and 4 onwards for the table */
+#define MATCH_TABLE_FIRST_INDEX     4
+#define MATCH_NONE                  0xFF
+
+typedef struct
+{
+	uint64_t tag_id;
+	uint16_t out0_period;            // OUT0's pulse width (ms)
+	uint8_t notifications;           // Same bits as REG_NOTIFICATIONS
+	uint16_t refractory;             // Minimum time between activations (ms), 0 if none
+	uint8_t quota;                   // Activations per quota window, 0 if no quota
+	uint16_t quota_window;           // (s)
+} match_entry_t;
+
+/************************************************************************/
+/* EEPROM                                                               */
+/*                                                                      */
+/* The core saves the first APP_NBYTES_TO_SAVE bytes of the registers'  */
+/* bank from CORE_EEPROM_APP_REGS, after its own registers and the      */
+/* device's name. Only the registers up to REG_OUT0_PERIOD, the others  */
+/* are kept on the configuration image. The detection log follows.     */
+/************************************************************************/
+#define CORE_EEPROM_APP_REGS        0x0020
+#define APP_NBYTES_TO_SAVE          77          // offsetof(AppRegs, REG_DETECTION_LOG_CONFIG)
+
+/* eeprom_is_busy() is not exported by the core library */
+#define eeprom_busy                 (NVM.STATUS & NVM_NVMBUSY_bm)
+
+/************************************************************************/
+/* SRAM                                                                 */
+/*                                                                      */
+/* The core takes 3025 bytes of the 4 KB (.data and .bss), most of it   */
+/* its TX buffer. The application's .data and .bss must leave           */
+/* APP_STACK_RESERVE bytes to the stack, for the main loop with the     */
+/* three levels nested on top. The linker gets the SRAM minus the       */
+/* reserve as its data region (linker flags on RfidReader.cppproj), so  */
+/* the build fails if they don't.                                       */
+/*                                                                      */
+/* REG_STACK_FREE reads the bytes above .bss the stack never reached    */
+/* since reset (see stack.h), so the stack took the rest up to RAMEND.  */
+/* Read after the self-test at the highest baud rate, the worst load,   */
+/* the reserve must hold that, plus a margin.                           */
+/************************************************************************/
+#define APP_STACK_RESERVE           128         // --defsym=__DATA_REGION_LENGTH__=3968
+
+
 /************************************************************************/
 /* Initialize the application                                           */
 /************************************************************************/
@@ -1,14 +1,31 @@
+#include <string.h>
+#include <avr/pgmspace.h>
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
 #include "hwbp_core.h"
+#include "u64_handoff.h"
+#include "detection_log.h"
+#include "config_image.h"
+#include "uart0.h"
+#include "wiegand.h"
+#include "latency.h"
+#include "out0_gate.h"
+#include "work.h"
+#include "self_test.h"
+#include "reader.h"
+#include "stack.h"
+#include "handler_time.h"
 
 
 /************************************************************************/
 /* Create pointers to functions                                         */
+/*                                                                      */
+/* The tables are only used by the application, so they live in flash   */
+/* and are read with pgm_read_word() (see core_read_app_register())     */
 /************************************************************************/
 extern AppRegs app_regs;
 
-void (*app_func_rd_pointer[])(void) = {
+void (* const app_func_rd_pointer[])(void) PROGMEM = {
 	&app_read_REG_TAG_ID_ARRIVED,
 	&app_read_REG_TAG_ID_LEAVED,
 	&app_read_REG_OUT,
@@ -31,10 +48,47 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_TAG_MATCH2_OUT0_PERIOD,
 	&app_read_REG_TAG_MATCH3_OUT0_PERIOD,
 	&app_read_REG_TAG_ID_ARRIVED_PERIOD,
-	&app_read_REG_OUT0_PERIOD
+	&app_read_REG_OUT0_PERIOD,
+	&app_read_REG_DETECTION_LOG_CONFIG,
+	&app_read_REG_DETECTION_LOG_PENDING,
+	&app_read_REG_DETECTION_LOG_RECORDS,
+	&app_read_REG_DETECTION_LOG_ACK,
+	&app_read_REG_CONFIG_IMAGE,
+	&app_read_REG_MATCH_TABLE,
+	&app_read_REG_RAW_FRAME_CONFIG,
+	&app_read_REG_RAW_FRAME,
+	&app_read_REG_READER_PROTOCOLS,
+	&app_read_REG_READER_INTERFACE,
+	&app_read_REG_TAG_ID_ANTENNA,
+	&app_read_REG_EVENT_CONFIG,
+	&app_read_REG_MATCH_INDEX_ARRIVED,
+	&app_read_REG_MATCH_INDEX_LEAVED,
+	&app_read_REG_TAG_ID_UNMATCHED,
+	&app_read_REG_STATS_CONFIG,
+	&app_read_REG_STATS,
+	&app_read_REG_PRESENCE_QUALITY,
+	&app_read_REG_LATENCY_HISTOGRAM,
+	&app_read_REG_RULES,
+	&app_read_REG_SUPPRESSED_ACTIVATIONS,
+	&app_read_REG_TAG_PRESENT,
+	&app_read_REG_TAG_PRESENT_OUT0_PERIOD,
+	&app_read_REG_TAG_PRESENT_NOTIFICATIONS,
+	&app_read_REG_OUT0_GATE,
+	&app_read_REG_OUT0_GATE_PULSE,
+	&app_read_REG_OUT0_GATE_HOLDOFF,
+	&app_read_REG_TAG_IN_RANGE_FILTER,
+	&app_read_REG_TAG_IN_RANGE_GLITCHES,
+	&app_read_REG_WORK_QUEUE,
+	&app_read_REG_SELF_TEST,
+	&app_read_REG_SELF_TEST_RESULT,
+	&app_read_REG_READER_BAUD_RATE,
+	&app_read_REG_FRAME_TIMING,
+	&app_read_REG_USER_PATTERN,
+	&app_read_REG_STACK_FREE,
+	&app_read_REG_HANDLER_TIMES
 };
 
-bool (*app_func_wr_pointer[])(void*) = {
+bool (* const app_func_wr_pointer[])(void*) PROGMEM = {
 	&app_write_REG_TAG_ID_ARRIVED,
 	&app_write_REG_TAG_ID_LEAVED,
 	&app_write_REG_OUT,
@@ -57,20 +111,66 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_TAG_MATCH2_OUT0_PERIOD,
 	&app_write_REG_TAG_MATCH3_OUT0_PERIOD,
 	&app_write_REG_TAG_ID_ARRIVED_PERIOD,
-	&app_write_REG_OUT0_PERIOD
+	&app_write_REG_OUT0_PERIOD,
+	&app_write_REG_DETECTION_LOG_CONFIG,
+	&app_write_REG_DETECTION_LOG_PENDING,
+	&app_write_REG_DETECTION_LOG_RECORDS,
+	&app_write_REG_DETECTION_LOG_ACK,
+	&app_write_REG_CONFIG_IMAGE,
+	&app_write_REG_MATCH_TABLE,
+	&app_write_REG_RAW_FRAME_CONFIG,
+	&app_write_REG_RAW_FRAME,
+	&app_write_REG_READER_PROTOCOLS,
+	&app_write_REG_READER_INTERFACE,
+	&app_write_REG_TAG_ID_ANTENNA,
+	&app_write_REG_EVENT_CONFIG,
+	&app_write_REG_MATCH_INDEX_ARRIVED,
+	&app_write_REG_MATCH_INDEX_LEAVED,
+	&app_write_REG_TAG_ID_UNMATCHED,
+	&app_write_REG_STATS_CONFIG,
+	&app_write_REG_STATS,
+	&app_write_REG_PRESENCE_QUALITY,
+	&app_write_REG_LATENCY_HISTOGRAM,
+	&app_write_REG_RULES,
+	&app_write_REG_SUPPRESSED_ACTIVATIONS,
+	&app_write_REG_TAG_PRESENT,
+	&app_write_REG_TAG_PRESENT_OUT0_PERIOD,
+	&app_write_REG_TAG_PRESENT_NOTIFICATIONS,
+	&app_write_REG_OUT0_GATE,
+	&app_write_REG_OUT0_GATE_PULSE,
+	&app_write_REG_OUT0_GATE_HOLDOFF,
+	&app_write_REG_TAG_IN_RANGE_FILTER,
+	&app_write_REG_TAG_IN_RANGE_GLITCHES,
+	&app_write_REG_WORK_QUEUE,
+	&app_write_REG_SELF_TEST,
+	&app_write_REG_SELF_TEST_RESULT,
+	&app_write_REG_READER_BAUD_RATE,
+	&app_write_REG_FRAME_TIMING,
+	&app_write_REG_USER_PATTERN,
+	&app_write_REG_STACK_FREE,
+	&app_write_REG_HANDLER_TIMES
 };
 
 
 /************************************************************************/
 /* REG_TAG_ID_ARRIVED                                                   */
 /************************************************************************/
-void app_read_REG_TAG_ID_ARRIVED(void) {}
+extern u64_handoff_t tag_id_arrived;
+extern u64_handoff_t tag_id_leaved;
+
+void app_read_REG_TAG_ID_ARRIVED(void)
+{
+	u64_handoff_read(&tag_id_arrived, &app_regs.REG_TAG_ID_ARRIVED);
+}
 bool app_write_REG_TAG_ID_ARRIVED(void *a) {return false;}
 
 /************************************************************************/
 /* REG_TAG_ID_LEAVED                                                    */
 /************************************************************************/
-void app_read_REG_TAG_ID_LEAVED(void) {}
+void app_read_REG_TAG_ID_LEAVED(void)
+{
+	u64_handoff_read(&tag_id_leaved, &app_regs.REG_TAG_ID_LEAVED);
+}
 bool app_write_REG_TAG_ID_LEAVED(void *a) {return false;}
 
 
@@ -84,6 +184,10 @@ bool app_write_REG_OUT(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 	
+	/* OUT0 belongs to the gate */
+	if (out0_gate_is_enabled())
+		return false;
+	
 	if (reg & B_OUT0)
 	{
 		set_OUT0;
@@ -184,9 +288,6 @@ bool app_write_REG_BUZZER_FREQUENCY(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 	
-	if (reg > 15000) return false;
-	if (reg < 200) return false;
-	
 	calculate_timer_16bits(32000000, reg, &buzzer_prescaler, &buzzer_target_count);	
 
 	app_regs.REG_BUZZER_FREQUENCY = reg;
@@ -202,9 +303,6 @@ bool app_write_REG_LED_TOP_BLINK_PERIOD(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 	
-	if (reg < 2)
-		return false;
-	
 	app_regs.REG_LED_TOP_BLINK_PERIOD = reg;
 	return true;
 }
@@ -218,9 +316,6 @@ bool app_write_REG_LED_BOTTOM_BLINK_PERIOD(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
 	
-	if (reg < 2)
-		return false;
-	
 	app_regs.REG_LED_BOTTOM_BLINK_PERIOD = reg;
 	return true;
 }
@@ -396,4 +491,494 @@ bool app_write_REG_OUT0_PERIOD(void *a)
 
 	app_regs.REG_OUT0_PERIOD = reg;
 	return true;
-}
\ No newline at end of file
+}
+
+/************************************************************************/
+/* REG_DETECTION_LOG_CONFIG                                             */
+/************************************************************************/
+void app_read_REG_DETECTION_LOG_CONFIG(void) {}
+bool app_write_REG_DETECTION_LOG_CONFIG(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_DETECTION_LOG_CONFIG = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DETECTION_LOG_PENDING                                            */
+/************************************************************************/
+void app_read_REG_DETECTION_LOG_PENDING(void)
+{
+	app_regs.REG_DETECTION_LOG_PENDING = detection_log_pending();
+}
+bool app_write_REG_DETECTION_LOG_PENDING(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_DETECTION_LOG_RECORDS                                            */
+/************************************************************************/
+void app_read_REG_DETECTION_LOG_RECORDS(void)
+{
+	detection_log_read(app_regs.REG_DETECTION_LOG_RECORDS, DETECTION_LOG_RECORDS_PER_READ);
+}
+bool app_write_REG_DETECTION_LOG_RECORDS(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_DETECTION_LOG_ACK                                                */
+/************************************************************************/
+void app_read_REG_DETECTION_LOG_ACK(void) {}
+bool app_write_REG_DETECTION_LOG_ACK(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	detection_log_ack(reg);
+
+	app_regs.REG_DETECTION_LOG_ACK = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CONFIG_IMAGE                                                     */
+/************************************************************************/
+void app_read_REG_CONFIG_IMAGE(void)
+{
+	app_regs.REG_CONFIG_IMAGE = config_image_is_saving() ? B_CONFIG_SAVE : 0;
+}
+bool app_write_REG_CONFIG_IMAGE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & B_CONFIG_SAVE)
+		config_image_save();
+	
+	if (reg & B_CONFIG_ERASE)
+		config_image_erase();
+
+	app_regs.REG_CONFIG_IMAGE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MATCH_TABLE                                                      */
+/************************************************************************/
+extern void reset_match_limits(void);
+
+void app_read_REG_MATCH_TABLE(void) {}
+bool app_write_REG_MATCH_TABLE(void *a)
+{
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	
+	/* The frame timeout (LOW level) must never see a half updated table */
+	PMIC.CTRL = pmic_ctrl & ~PMIC_LOLVLEN_bm;
+	memcpy(app_regs.REG_MATCH_TABLE, a, sizeof(app_regs.REG_MATCH_TABLE));
+	reset_match_limits();
+	PMIC.CTRL = pmic_ctrl;
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RAW_FRAME_CONFIG                                                 */
+/************************************************************************/
+void app_read_REG_RAW_FRAME_CONFIG(void) {}
+bool app_write_REG_RAW_FRAME_CONFIG(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_RAW_FRAME_CONFIG = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RAW_FRAME                                                        */
+/************************************************************************/
+void app_read_REG_RAW_FRAME(void) {}
+bool app_write_REG_RAW_FRAME(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_READER_PROTOCOLS                                                 */
+/************************************************************************/
+void app_read_REG_READER_PROTOCOLS(void) {}
+bool app_write_REG_READER_PROTOCOLS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_READER_PROTOCOLS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_READER_INTERFACE                                                 */
+/************************************************************************/
+void app_read_REG_READER_INTERFACE(void) {}
+bool app_write_REG_READER_INTERFACE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	/* D0 is shared with the UART's RX */
+	if (reg == GM_READER_WIEGAND)
+	{
+		uart0_disable();
+		wiegand_enable();
+	}
+	else
+	{
+		wiegand_disable();
+		uart0_enable();
+	}
+	
+	/* The frame timeout follows the interface */
+	app_regs.REG_READER_INTERFACE = reg;
+	reader_set_baud_rate(app_regs.REG_READER_BAUD_RATE);
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EVENT_CONFIG                                                     */
+/************************************************************************/
+void app_read_REG_EVENT_CONFIG(void) {}
+bool app_write_REG_EVENT_CONFIG(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_EVENT_CONFIG = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MATCH_INDEX_ARRIVED                                              */
+/************************************************************************/
+void app_read_REG_MATCH_INDEX_ARRIVED(void) {}
+bool app_write_REG_MATCH_INDEX_ARRIVED(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_MATCH_INDEX_LEAVED                                               */
+/************************************************************************/
+void app_read_REG_MATCH_INDEX_LEAVED(void) {}
+bool app_write_REG_MATCH_INDEX_LEAVED(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_TAG_ID_UNMATCHED                                                 */
+/************************************************************************/
+void app_read_REG_TAG_ID_UNMATCHED(void) {}
+bool app_write_REG_TAG_ID_UNMATCHED(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_STATS_CONFIG                                                     */
+/************************************************************************/
+void app_read_REG_STATS_CONFIG(void) {}
+bool app_write_REG_STATS_CONFIG(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_STATS_CONFIG = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STATS                                                            */
+/************************************************************************/
+void app_read_REG_STATS(void) {}
+bool app_write_REG_STATS(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_PRESENCE_QUALITY                                                 */
+/************************************************************************/
+void app_read_REG_PRESENCE_QUALITY(void) {}
+bool app_write_REG_PRESENCE_QUALITY(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_LATENCY_HISTOGRAM                                                */
+/************************************************************************/
+void app_read_REG_LATENCY_HISTOGRAM(void) {}
+bool app_write_REG_LATENCY_HISTOGRAM(void *a)
+{
+	/* Any write resets the histograms */
+	latency_reset();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RULES                                                            */
+/************************************************************************/
+void app_read_REG_RULES(void) {}
+bool app_write_REG_RULES(void *a)
+{
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	
+	/* The frame timeout (LOW level) must never see a half updated rule */
+	PMIC.CTRL = pmic_ctrl & ~PMIC_LOLVLEN_bm;
+	memcpy(app_regs.REG_RULES, a, sizeof(app_regs.REG_RULES));
+	PMIC.CTRL = pmic_ctrl;
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SUPPRESSED_ACTIVATIONS                                           */
+/************************************************************************/
+void app_read_REG_SUPPRESSED_ACTIVATIONS(void) {}
+bool app_write_REG_SUPPRESSED_ACTIVATIONS(void *a)
+{
+	/* Any write resets the counters */
+	memset(app_regs.REG_SUPPRESSED_ACTIVATIONS, 0, sizeof(app_regs.REG_SUPPRESSED_ACTIVATIONS));
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TAG_PRESENT                                                      */
+/************************************************************************/
+void app_read_REG_TAG_PRESENT(void) {}
+bool app_write_REG_TAG_PRESENT(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_TAG_PRESENT_OUT0_PERIOD                                          */
+/************************************************************************/
+void app_read_REG_TAG_PRESENT_OUT0_PERIOD(void) {}
+bool app_write_REG_TAG_PRESENT_OUT0_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	/* Same limit as REG_OUT0_PERIOD */
+	if (reg == 0xFFFF)
+		reg--;
+
+	app_regs.REG_TAG_PRESENT_OUT0_PERIOD = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TAG_PRESENT_NOTIFICATIONS                                        */
+/************************************************************************/
+void app_read_REG_TAG_PRESENT_NOTIFICATIONS(void) {}
+bool app_write_REG_TAG_PRESENT_NOTIFICATIONS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_TAG_PRESENT_NOTIFICATIONS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OUT0_GATE                                                        */
+/************************************************************************/
+void app_read_REG_OUT0_GATE(void) {}
+bool app_write_REG_OUT0_GATE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	app_regs.REG_OUT0_GATE = reg;
+	
+	if (reg & B_OUT0_GATE_EN)
+	{
+		/* Hand OUT0 over, a software pulse may be running */
+		if (!out0_gate_is_enabled())
+		{
+			clr_OUT0;
+			clr_LED_OUT0;
+		}
+		
+		out0_gate_enable();
+	}
+	else if (out0_gate_is_enabled())
+	{
+		out0_gate_disable();
+		clr_LED_OUT0;
+		app_regs.REG_OUT = 0;
+	}
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OUT0_GATE_PULSE                                                  */
+/************************************************************************/
+void app_read_REG_OUT0_GATE_PULSE(void) {}
+bool app_write_REG_OUT0_GATE_PULSE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_OUT0_GATE_PULSE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OUT0_GATE_HOLDOFF                                                */
+/************************************************************************/
+void app_read_REG_OUT0_GATE_HOLDOFF(void) {}
+bool app_write_REG_OUT0_GATE_HOLDOFF(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_OUT0_GATE_HOLDOFF = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TAG_IN_RANGE_FILTER                                              */
+/************************************************************************/
+extern void reset_tag_in_range_filter(void);
+
+void app_read_REG_TAG_IN_RANGE_FILTER(void) {}
+bool app_write_REG_TAG_IN_RANGE_FILTER(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+
+	app_regs.REG_TAG_IN_RANGE_FILTER[0] = reg[0];
+	app_regs.REG_TAG_IN_RANGE_FILTER[1] = reg[1];
+	reset_tag_in_range_filter();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TAG_IN_RANGE_GLITCHES                                            */
+/************************************************************************/
+void app_read_REG_TAG_IN_RANGE_GLITCHES(void) {}
+bool app_write_REG_TAG_IN_RANGE_GLITCHES(void *a)
+{
+	/* Any write resets the counter */
+	app_regs.REG_TAG_IN_RANGE_GLITCHES = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WORK_QUEUE                                                       */
+/************************************************************************/
+void app_read_REG_WORK_QUEUE(void) {}
+bool app_write_REG_WORK_QUEUE(void *a)
+{
+	/* Any write resets the counters */
+	app_regs.REG_WORK_QUEUE[WORK_MAX_DEPTH] = 0;
+	app_regs.REG_WORK_QUEUE[WORK_WORST_WAIT] = 0;
+	app_regs.REG_WORK_QUEUE[WORK_DROPPED] = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SELF_TEST                                                        */
+/************************************************************************/
+void app_read_REG_SELF_TEST(void) {}
+bool app_write_REG_SELF_TEST(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg == 0)
+	{
+		self_test_stop();
+		return true;
+	}
+	
+	if (!self_test_start(reg))
+		return false;
+	
+	app_regs.REG_SELF_TEST = reg & app_regs.REG_READER_PROTOCOLS;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SELF_TEST_RESULT                                                 */
+/************************************************************************/
+void app_read_REG_SELF_TEST_RESULT(void) {}
+bool app_write_REG_SELF_TEST_RESULT(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_READER_BAUD_RATE                                                 */
+/************************************************************************/
+void app_read_REG_READER_BAUD_RATE(void) {}
+bool app_write_REG_READER_BAUD_RATE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	reader_set_baud_rate(reg);
+	
+	app_regs.REG_READER_BAUD_RATE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FRAME_TIMING                                                     */
+/************************************************************************/
+void app_read_REG_FRAME_TIMING(void)
+{
+	uint8_t sreg = SREG;
+	
+	/* Learned by the RX interrupt (MED level) */
+	cli();
+	app_regs.REG_FRAME_TIMING[0] = readers[0].byte_time * 2;
+	app_regs.REG_FRAME_TIMING[1] = readers[0].timeout * 32;
+	app_regs.REG_FRAME_TIMING[2] = readers[0].timeout_backoffs;
+	SREG = sreg;
+}
+
+bool app_write_REG_FRAME_TIMING(void *a)
+{
+	/* Any write restarts the learning */
+	reader_reset_timeouts();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_USER_PATTERN                                                     */
+/************************************************************************/
+void app_read_REG_USER_PATTERN(void) {}
+bool app_write_REG_USER_PATTERN(void *a)
+{
+	memcpy(app_regs.REG_USER_PATTERN, a, sizeof(app_regs.REG_USER_PATTERN));
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_STACK_FREE                                                       */
+/************************************************************************/
+void app_read_REG_STACK_FREE(void)
+{
+	app_regs.REG_STACK_FREE = stack_free();
+}
+bool app_write_REG_STACK_FREE(void *a) {return false;}
+
+
+/************************************************************************/
+/* REG_HANDLER_TIMES                                                    */
+/************************************************************************/
+void app_read_REG_HANDLER_TIMES(void) {}
+bool app_write_REG_HANDLER_TIMES(void *a)
+{
+	/* Any write resets the times */
+	handler_time_reset();
+	return true;
+}
@@ -43,6 +43,43 @@ void app_read_REG_TAG_MATCH2_OUT0_PERIOD(void);
 void app_read_REG_TAG_MATCH3_OUT0_PERIOD(void);
 void app_read_REG_TAG_ID_ARRIVED_PERIOD(void);
 void app_read_REG_OUT0_PERIOD(void);
+void app_read_REG_DETECTION_LOG_CONFIG(void);
+void app_read_REG_DETECTION_LOG_PENDING(void);
+void app_read_REG_DETECTION_LOG_RECORDS(void);
+void app_read_REG_DETECTION_LOG_ACK(void);
+void app_read_REG_CONFIG_IMAGE(void);
+void app_read_REG_MATCH_TABLE(void);
+void app_read_REG_RAW_FRAME_CONFIG(void);
+void app_read_REG_RAW_FRAME(void);
+void app_read_REG_READER_PROTOCOLS(void);
+void app_read_REG_READER_INTERFACE(void);
+void app_read_REG_TAG_ID_ANTENNA(void);
+void app_read_REG_EVENT_CONFIG(void);
+void app_read_REG_MATCH_INDEX_ARRIVED(void);
+void app_read_REG_MATCH_INDEX_LEAVED(void);
+void app_read_REG_TAG_ID_UNMATCHED(void);
+void app_read_REG_STATS_CONFIG(void);
+void app_read_REG_STATS(void);
+void app_read_REG_PRESENCE_QUALITY(void);
+void app_read_REG_LATENCY_HISTOGRAM(void);
+void app_read_REG_RULES(void);
+void app_read_REG_SUPPRESSED_ACTIVATIONS(void);
+void app_read_REG_TAG_PRESENT(void);
+void app_read_REG_TAG_PRESENT_OUT0_PERIOD(void);
+void app_read_REG_TAG_PRESENT_NOTIFICATIONS(void);
+void app_read_REG_OUT0_GATE(void);
+void app_read_REG_OUT0_GATE_PULSE(void);
+void app_read_REG_OUT0_GATE_HOLDOFF(void);
+void app_read_REG_TAG_IN_RANGE_FILTER(void);
+void app_read_REG_TAG_IN_RANGE_GLITCHES(void);
+void app_read_REG_WORK_QUEUE(void);
+void app_read_REG_SELF_TEST(void);
+void app_read_REG_SELF_TEST_RESULT(void);
+void app_read_REG_READER_BAUD_RATE(void);
+void app_read_REG_FRAME_TIMING(void);
+void app_read_REG_USER_PATTERN(void);
+void app_read_REG_STACK_FREE(void);
+void app_read_REG_HANDLER_TIMES(void);
 
 bool app_write_REG_TAG_ID_ARRIVED(void *a);
 bool app_write_REG_TAG_ID_LEAVED(void *a);
@@ -67,6 +104,43 @@ bool app_write_REG_TAG_MATCH2_OUT0_PERIOD(void *a);
 bool app_write_REG_TAG_MATCH3_OUT0_PERIOD(void *a);
 bool app_write_REG_TAG_ID_ARRIVED_PERIOD(void *a);
 bool app_write_REG_OUT0_PERIOD(void *a);
+bool app_write_REG_DETECTION_LOG_CONFIG(void *a);
+bool app_write_REG_DETECTION_LOG_PENDING(void *a);
+bool app_write_REG_DETECTION_LOG_RECORDS(void *a);
+bool app_write_REG_DETECTION_LOG_ACK(void *a);
+bool app_write_REG_CONFIG_IMAGE(void *a);
+bool app_write_REG_MATCH_TABLE(void *a);
+bool app_write_REG_RAW_FRAME_CONFIG(void *a);
+bool app_write_REG_RAW_FRAME(void *a);
+bool app_write_REG_READER_PROTOCOLS(void *a);
+bool app_write_REG_READER_INTERFACE(void *a);
+bool app_write_REG_TAG_ID_ANTENNA(void *a);
+bool app_write_REG_EVENT_CONFIG(void *a);
+bool app_write_REG_MATCH_INDEX_ARRIVED(void *a);
+bool app_write_REG_MATCH_INDEX_LEAVED(void *a);
+bool app_write_REG_TAG_ID_UNMATCHED(void *a);
+bool app_write_REG_STATS_CONFIG(void *a);
+bool app_write_REG_STATS(void *a);
+bool app_write_REG_PRESENCE_QUALITY(void *a);
+bool app_write_REG_LATENCY_HISTOGRAM(void *a);
+bool app_write_REG_RULES(void *a);
+bool app_write_REG_SUPPRESSED_ACTIVATIONS(void *a);
+bool app_write_REG_TAG_PRESENT(void *a);
+bool app_write_REG_TAG_PRESENT_OUT0_PERIOD(void *a);
+bool app_write_REG_TAG_PRESENT_NOTIFICATIONS(void *a);
+bool app_write_REG_OUT0_GATE(void *a);
+bool app_write_REG_OUT0_GATE_PULSE(void *a);
+bool app_write_REG_OUT0_GATE_HOLDOFF(void *a);
+bool app_write_REG_TAG_IN_RANGE_FILTER(void *a);
+bool app_write_REG_TAG_IN_RANGE_GLITCHES(void *a);
+bool app_write_REG_WORK_QUEUE(void *a);
+bool app_write_REG_SELF_TEST(void *a);
+bool app_write_REG_SELF_TEST_RESULT(void *a);
+bool app_write_REG_READER_BAUD_RATE(void *a);
+bool app_write_REG_FRAME_TIMING(void *a);
+bool app_write_REG_USER_PATTERN(void *a);
+bool app_write_REG_STACK_FREE(void *a);
+bool app_write_REG_HANDLER_TIMES(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 #include "hwbp_core_types.h"
 #include "app_ios_and_regs.h"
 
@@ -10,7 +11,7 @@ void init_ios(void)
 	io_pin2in(&PORTC, 3, PULL_IO_TRISTATE, SENSE_IO_EDGES_BOTH);         // TAG_IN_RANGE
 
 	/* Configure input interrupts */
-	io_set_int(&PORTC, INT_LEVEL_LOW, 0, (1<<3), false);                 // TAG_IN_RANGE
+	io_set_int(&PORTC, INT_LEVEL_HIGH, 0, (1<<3), false);                // TAG_IN_RANGE
 
 	/* Configure output pins */
 	io_pin2out(&PORTD, 0, OUT_IO_DIGITAL, IN_EN_IO_EN);                  // BUZZER
@@ -32,6 +33,13 @@ void init_ios(void)
 /************************************************************************/
 AppRegs app_regs;
 
+/* The tables below are generated from device.yml, with the names of  */
+/* the ADD_REG_ defines, by Generators/app_regs.py. It also checks     */
+/* AppRegs and the memory limits against device.yml                    */
+
+/* app_regs_type[], app_regs_n_elements[] and app_regs_pointer[] are  */
+/* also read by the Harp core library with data-space loads, so they  */
+/* can not be moved to flash like the handlers tables in app_funcs.c  */
 uint8_t app_regs_type[] = {
 	TYPE_U64,
 	TYPE_U64,
@@ -55,6 +63,43 @@ uint8_t app_regs_type[] = {
 	TYPE_U16,
 	TYPE_U16,
 	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U64,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
 	TYPE_U16
 };
 
@@ -81,7 +126,44 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
-	1
+	1,
+	1,
+	1,
+	32,
+	1,
+	1,
+	32,
+	1,
+	31,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	4,
+	4,
+	24,
+	39,
+	2,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	2,
+	1,
+	3,
+	1,
+	4,
+	1,
+	3,
+	16,
+	1,
+	3
 };
 
 uint8_t *app_regs_pointer[] = {
@@ -107,5 +189,171 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_TAG_MATCH2_OUT0_PERIOD),
 	(uint8_t*)(&app_regs.REG_TAG_MATCH3_OUT0_PERIOD),
 	(uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED_PERIOD),
-	(uint8_t*)(&app_regs.REG_OUT0_PERIOD)
+	(uint8_t*)(&app_regs.REG_OUT0_PERIOD),
+	(uint8_t*)(&app_regs.REG_DETECTION_LOG_CONFIG),
+	(uint8_t*)(&app_regs.REG_DETECTION_LOG_PENDING),
+	(uint8_t*)(app_regs.REG_DETECTION_LOG_RECORDS),
+	(uint8_t*)(&app_regs.REG_DETECTION_LOG_ACK),
+	(uint8_t*)(&app_regs.REG_CONFIG_IMAGE),
+	(uint8_t*)(app_regs.REG_MATCH_TABLE),
+	(uint8_t*)(&app_regs.REG_RAW_FRAME_CONFIG),
+	(uint8_t*)(app_regs.REG_RAW_FRAME),
+	(uint8_t*)(&app_regs.REG_READER_PROTOCOLS),
+	(uint8_t*)(&app_regs.REG_READER_INTERFACE),
+	(uint8_t*)(&app_regs.REG_TAG_ID_ANTENNA),
+	(uint8_t*)(&app_regs.REG_EVENT_CONFIG),
+	(uint8_t*)(&app_regs.REG_MATCH_INDEX_ARRIVED),
+	(uint8_t*)(&app_regs.REG_MATCH_INDEX_LEAVED),
+	(uint8_t*)(&app_regs.REG_TAG_ID_UNMATCHED),
+	(uint8_t*)(&app_regs.REG_STATS_CONFIG),
+	(uint8_t*)(app_regs.REG_STATS),
+	(uint8_t*)(app_regs.REG_PRESENCE_QUALITY),
+	(uint8_t*)(app_regs.REG_LATENCY_HISTOGRAM),
+	(uint8_t*)(app_regs.REG_RULES),
+	(uint8_t*)(app_regs.REG_SUPPRESSED_ACTIVATIONS),
+	(uint8_t*)(&app_regs.REG_TAG_PRESENT),
+	(uint8_t*)(&app_regs.REG_TAG_PRESENT_OUT0_PERIOD),
+	(uint8_t*)(&app_regs.REG_TAG_PRESENT_NOTIFICATIONS),
+	(uint8_t*)(&app_regs.REG_OUT0_GATE),
+	(uint8_t*)(&app_regs.REG_OUT0_GATE_PULSE),
+	(uint8_t*)(&app_regs.REG_OUT0_GATE_HOLDOFF),
+	(uint8_t*)(app_regs.REG_TAG_IN_RANGE_FILTER),
+	(uint8_t*)(&app_regs.REG_TAG_IN_RANGE_GLITCHES),
+	(uint8_t*)(app_regs.REG_WORK_QUEUE),
+	(uint8_t*)(&app_regs.REG_SELF_TEST),
+	(uint8_t*)(app_regs.REG_SELF_TEST_RESULT),
+	(uint8_t*)(&app_regs.REG_READER_BAUD_RATE),
+	(uint8_t*)(app_regs.REG_FRAME_TIMING),
+	(uint8_t*)(app_regs.REG_USER_PATTERN),
+	(uint8_t*)(&app_regs.REG_STACK_FREE),
+	(uint8_t*)(app_regs.REG_HANDLER_TIMES)
+};
+
+/* Valid range of the registers, from minValue and maxValue on          */
+/* device.yml. 0 and 0xFFFF if not checked.                             */
+/* Only checked on U8 and U16 registers, on every element               */
+const uint16_t app_regs_min[] PROGMEM = {
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	2,
+	2,
+	200,
+	2,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	2,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	0
+};
+
+const uint16_t app_regs_max[] PROGMEM = {
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	15000,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	2,
+	0xFFFF,
+	3,
+	0xFFFF,
+	3,
+	1,
+	0xFFFF,
+	15,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	1,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	87,
+	3,
+	2000,
+	0xFFFF,
+	2000,
+	0xFFFF,
+	0xFFFF,
+	3,
+	0xFFFF,
+	4,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF
 };
\ No newline at end of file
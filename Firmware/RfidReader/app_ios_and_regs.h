@@ -78,6 +78,43 @@ typedef struct
 	uint16_t REG_TAG_MATCH3_OUT0_PERIOD;
 	uint16_t REG_TAG_ID_ARRIVED_PERIOD;
 	uint16_t REG_OUT0_PERIOD;
+	uint8_t REG_DETECTION_LOG_CONFIG;
+	uint16_t REG_DETECTION_LOG_PENDING;
+	uint8_t REG_DETECTION_LOG_RECORDS[32];
+	uint8_t REG_DETECTION_LOG_ACK;
+	uint8_t REG_CONFIG_IMAGE;
+	uint8_t REG_MATCH_TABLE[32];
+	uint8_t REG_RAW_FRAME_CONFIG;
+	uint8_t REG_RAW_FRAME[31];
+	uint8_t REG_READER_PROTOCOLS;
+	uint8_t REG_READER_INTERFACE;
+	uint8_t REG_TAG_ID_ANTENNA;
+	uint8_t REG_EVENT_CONFIG;
+	uint8_t REG_MATCH_INDEX_ARRIVED;
+	uint8_t REG_MATCH_INDEX_LEAVED;
+	uint64_t REG_TAG_ID_UNMATCHED;
+	uint8_t REG_STATS_CONFIG;
+	uint16_t REG_STATS[4];
+	uint16_t REG_PRESENCE_QUALITY[4];
+	uint16_t REG_LATENCY_HISTOGRAM[24];
+	uint8_t REG_RULES[39];
+	uint16_t REG_SUPPRESSED_ACTIVATIONS[2];
+	uint8_t REG_TAG_PRESENT;
+	uint16_t REG_TAG_PRESENT_OUT0_PERIOD;
+	uint8_t REG_TAG_PRESENT_NOTIFICATIONS;
+	uint8_t REG_OUT0_GATE;
+	uint16_t REG_OUT0_GATE_PULSE;
+	uint16_t REG_OUT0_GATE_HOLDOFF;
+	uint16_t REG_TAG_IN_RANGE_FILTER[2];
+	uint16_t REG_TAG_IN_RANGE_GLITCHES;
+	uint16_t REG_WORK_QUEUE[3];
+	uint8_t REG_SELF_TEST;
+	uint16_t REG_SELF_TEST_RESULT[4];
+	uint8_t REG_READER_BAUD_RATE;
+	uint16_t REG_FRAME_TIMING[3];
+	uint8_t REG_USER_PATTERN[16];
+	uint16_t REG_STACK_FREE;
+	uint16_t REG_HANDLER_TIMES[3];
 } AppRegs;
 
 /************************************************************************/
@@ -107,6 +144,43 @@ typedef struct
 #define ADD_REG_TAG_MATCH3_OUT0_PERIOD      52 // U16    Defines the amount of time in ms that the digital output OUT0 will be at logic high when TAG_ID3 is detected
 #define ADD_REG_TAG_ID_ARRIVED_PERIOD       53 // U16    When a tag is detected, OUT0 will be at high level for this amount of time in ms
 #define ADD_REG_OUT0_PERIOD                 54 // U16    When writing to this register, the OUT0 will be on for this amount of time in ms
+#define ADD_REG_DETECTION_LOG_CONFIG        55 // U8     Configures the detection log on the EEPROM
+#define ADD_REG_DETECTION_LOG_PENDING       56 // U16    Number of detection records on the log not yet acknowledged
+#define ADD_REG_DETECTION_LOG_RECORDS       57 // U8     Oldest detection records not yet acknowledged (2 records of 16 bytes)
+#define ADD_REG_DETECTION_LOG_ACK           58 // U8     Acknowledges the detection records up to the specified sequence number
+#define ADD_REG_CONFIG_IMAGE                59 // U8     Saves or erases the configuration image on the EEPROM
+#define ADD_REG_MATCH_TABLE                 60 // U8     Match table, 2 entries of 16 bytes, see match_entry_t
+#define ADD_REG_RAW_FRAME_CONFIG            61 // U8     Configures which frames are published on REG_RAW_FRAME
+#define ADD_REG_RAW_FRAME                   62 // U8     Frame's length followed by the first 30 bytes of the frame, as received
+#define ADD_REG_READER_PROTOCOLS            63 // U8     Enables the reader protocols that are decoded
+#define ADD_REG_READER_INTERFACE            64 // U8     Selects the reader module's output, ASCII or Wiegand
+#define ADD_REG_TAG_ID_ANTENNA              65 // U8     Reader module of the next arrival event, sent only with more than one reader
+#define ADD_REG_EVENT_CONFIG                66 // U8     Configures the compact, unmatched, quality and early detection events
+#define ADD_REG_MATCH_INDEX_ARRIVED         67 // U8     Index of the matching ID of the tag that arrived
+#define ADD_REG_MATCH_INDEX_LEAVED          68 // U8     Index of the matching ID of the tag that left
+#define ADD_REG_TAG_ID_UNMATCHED            69 // U64    ID of a tag that doesn't match any ID
+#define ADD_REG_STATS_CONFIG                70 // U8     Enables the statistics event sent each second
+#define ADD_REG_STATS                       71 // U16    Detections, unique tags, time with a tag in range (ms) and frame errors on the last second
+#define ADD_REG_PRESENCE_QUALITY            72 // U16    Valid frames, frame errors, mean and minimum interval between frames (ms) of the tag that left
+#define ADD_REG_LATENCY_HISTOGRAM           73 // U16    Histograms of the detection latencies
+#define ADD_REG_RULES                       74 // U8     Condition to action rules
+#define ADD_REG_SUPPRESSED_ACTIVATIONS      75 // U16    Activations suppressed on each match table entry
+#define ADD_REG_TAG_PRESENT                 76 // U8     Event on the rising edge of TAG_IN_RANGE, before the ID
+#define ADD_REG_TAG_PRESENT_OUT0_PERIOD     77 // U16    OUT0 pulse on the rising edge of TAG_IN_RANGE (ms), 0 if none
+#define ADD_REG_TAG_PRESENT_NOTIFICATIONS   78 // U8     Notifications on the rising edge of TAG_IN_RANGE
+#define ADD_REG_OUT0_GATE                   79 // U8     OUT0 gated by TAG_IN_RANGE through the event system
+#define ADD_REG_OUT0_GATE_PULSE             80 // U16    Minimum pulse of the gated OUT0 (ms)
+#define ADD_REG_OUT0_GATE_HOLDOFF           81 // U16    Hold-off after a pulse of the gated OUT0 (ms)
+#define ADD_REG_TAG_IN_RANGE_FILTER         82 // U16    Minimum stable time of the TAG_IN_RANGE rising and falling edges (ms)
+#define ADD_REG_TAG_IN_RANGE_GLITCHES       83 // U16    TAG_IN_RANGE transitions filtered out
+#define ADD_REG_WORK_QUEUE                  84 // U16    Bottom half's maximum depth, worst wait (us) and frames dropped
+#define ADD_REG_SELF_TEST                   85 // U8     Starts the throughput self-test with the protocols' synthetic frames
+#define ADD_REG_SELF_TEST_RESULT            86 // U16    Self-test's frames per second, frames dropped, tick overruns and byte period (us)
+#define ADD_REG_READER_BAUD_RATE            87 // U8     Reader modules' baud rate
+#define ADD_REG_FRAME_TIMING                88 // U16    First reader's byte time (us), frame timeout (us) and timeout back-offs
+#define ADD_REG_USER_PATTERN                89 // U8     Notification sequencer's user pattern
+#define ADD_REG_STACK_FREE                  90 // U16    Bytes above .bss the stack never reached since reset
+#define ADD_REG_HANDLER_TIMES               91 // U16    Longest HIGH, MED and LOW handlers (0.25 us)
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -116,8 +190,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x36
-#define APP_NBYTES_OF_REG_BANK              77
+#define APP_REGS_ADD_MAX                    0x5B
+#define APP_NBYTES_OF_REG_BANK              361
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -129,5 +203,27 @@ typedef struct
 #define B_TRIG_BUZZER                      (1<<0)       // Triggers notification on buzzer
 #define B_TRIG_TOP_LED                     (1<<1)       // Triggers notification on top's LED
 #define B_TRIG_BOTTOM_LED                  (1<<2)       // Triggers notification on bottom's LED
+#define B_LOG_EN                           (1<<0)       // Enables the detection log on the EEPROM
+#define B_CONFIG_SAVE                      (1<<0)       // Saves the configuration image on the EEPROM
+#define B_CONFIG_ERASE                     (1<<1)       // Erases the configuration image on the EEPROM
+#define B_RAW_UNDECODED                    (1<<0)       // Publishes the frames that can't be decoded
+#define B_RAW_ALL                          (1<<1)       // Publishes all frames
+#define B_PROTOCOL_EM4100                  (1<<0)       // Decodes EM4100 frames (125 KHz)
+#define B_PROTOCOL_FDX_B                   (1<<1)       // Decodes FDX-B frames (134.2 KHz, ISO11785)
+#define GM_READER_ASCII                    0            // Reader module's ASCII output on the UART
+#define GM_READER_WIEGAND                  1            // Reader module's Wiegand output on D0 and D1
+#define GM_BAUD_9600                       0            // 9600 bps
+#define GM_BAUD_19200                      1            // 19200 bps
+#define GM_BAUD_38400                      2            // 38400 bps
+#define GM_BAUD_57600                      3            // 57600 bps
+#define GM_BAUD_115200                     4            // 115200 bps
+#define B_MATCH_INDEX_EN                   (1<<0)       // Sends the index of the matching ID instead of the tag's ID
+#define B_UNMATCHED_EN                     (1<<1)       // Sends the ID of the tags that don't match
+#define B_QUALITY_EN                       (1<<2)       // Sends the read quality before the leave event
+#define B_PRESENT_EN                       (1<<3)       // Sends an event on the rising edge of TAG_IN_RANGE
+#define B_OUT0_GATE_EN                     (1<<0)       // OUT0 is pulsed by the hardware on the rising edge of TAG_IN_RANGE
+#define B_OUT0_GATE_FOLLOW                 (1<<1)       // The pulse lasts until the falling edge
+#define B_STATS_EN                         (1<<0)       // Sends the statistics each second
+#define GM_PATTERN                         (7<<4)       // Notification sequencer's pattern, 1 to 4 built in, 5 the user's, 0 if none
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
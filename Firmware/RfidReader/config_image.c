@@ -0,0 +1,239 @@
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+#include "cpu.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "config_image.h"
+
+
+/************************************************************************/
+/* Registers on the image                                               */
+/************************************************************************/
+static const uint8_t config_regs[] PROGMEM = {
+	ADD_REG_NOTIFICATIONS,
+	ADD_REG_TRIGGER_NOTIFICATIONS,
+	ADD_REG_TIME_ON_BUZZER,
+	ADD_REG_TIME_ON_LED_TOP,
+	ADD_REG_TIME_ON_LED_BOTTOM,
+	ADD_REG_BUZZER_FREQUENCY,
+	ADD_REG_LED_TOP_BLINK_PERIOD,
+	ADD_REG_LED_BOTTOM_BLINK_PERIOD,
+	ADD_REG_TAG_MATCH0,
+	ADD_REG_TAG_MATCH1,
+	ADD_REG_TAG_MATCH2,
+	ADD_REG_TAG_MATCH3,
+	ADD_REG_TAG_MATCH0_OUT0_PERIOD,
+	ADD_REG_TAG_MATCH1_OUT0_PERIOD,
+	ADD_REG_TAG_MATCH2_OUT0_PERIOD,
+	ADD_REG_TAG_MATCH3_OUT0_PERIOD,
+	ADD_REG_TAG_ID_ARRIVED_PERIOD,
+	ADD_REG_DETECTION_LOG_CONFIG,
+	ADD_REG_MATCH_TABLE,
+	ADD_REG_READER_PROTOCOLS,
+	ADD_REG_READER_INTERFACE,
+	ADD_REG_EVENT_CONFIG,
+	ADD_REG_STATS_CONFIG,
+	ADD_REG_RULES,
+	ADD_REG_TAG_PRESENT_OUT0_PERIOD,
+	ADD_REG_TAG_PRESENT_NOTIFICATIONS,
+	ADD_REG_OUT0_GATE,
+	ADD_REG_OUT0_GATE_PULSE,
+	ADD_REG_OUT0_GATE_HOLDOFF,
+	ADD_REG_TAG_IN_RANGE_FILTER,
+	ADD_REG_READER_BAUD_RATE
+};
+
+#define CONFIG_N_REGS               sizeof(config_regs)
+
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+#define reg_index(i)                (pgm_read_byte(&config_regs[i]) - APP_REGS_ADD_MIN)
+#define reg_length(index)           ((app_regs_type[index] & MSK_TYPE_LEN) * app_regs_n_elements[index])
+
+#define VERSION_ADDRESS             (CONFIG_IMAGE_EEPROM_START)
+#define LENGTH_ADDRESS              (CONFIG_IMAGE_EEPROM_START + 1)
+#define PAYLOAD_ADDRESS             (CONFIG_IMAGE_EEPROM_START + 2)
+#define crc_address(length)         (PAYLOAD_ADDRESS + (length))
+
+static uint8_t payload_length(void)
+{
+	uint8_t length = 0;
+	
+	for (uint8_t i = 0; i < CONFIG_N_REGS; i++)
+		length += reg_length(reg_index(i));
+	
+	return length;
+}
+
+/************************************************************************/
+/* Load the image                                                       */
+/*                                                                      */
+/* The image is checked as a whole before touching the registers, so a  */
+/* stale or corrupted image is never applied partially. The handlers    */
+/* are not called, the caller updates what depends on the registers.    */
+/************************************************************************/
+bool config_image_load(void)
+{
+	extern bool app_regs_content_is_in_range(uint8_t index, uint8_t type, uint8_t * content, uint16_t n_elements);
+	
+	uint8_t length = payload_length();
+	uint16_t address;
+	uint16_t crc = 0xFFFF;
+	uint8_t content[8];
+	
+	if (eeprom_rd_byte(VERSION_ADDRESS) != CONFIG_IMAGE_VERSION)
+		return false;
+	
+	if (eeprom_rd_byte(LENGTH_ADDRESS) != length)
+		return false;
+	
+	for (address = PAYLOAD_ADDRESS; address < crc_address(length); address++)
+		crc = _crc_ccitt_update(crc, eeprom_rd_byte(address));
+	
+	if (crc != (eeprom_rd_byte(crc_address(length)) | (eeprom_rd_byte(crc_address(length) + 1) << 8)))
+		return false;
+	
+	/* Check the content of each element against the register's range */
+	address = PAYLOAD_ADDRESS;
+	
+	for (uint8_t i = 0; i < CONFIG_N_REGS; i++)
+	{
+		uint8_t index = reg_index(i);
+		uint8_t type = app_regs_type[index];
+		
+		for (uint16_t element = 0; element < app_regs_n_elements[index]; element++)
+		{
+			for (uint8_t j = 0; j < (type & MSK_TYPE_LEN); j++)
+				content[j] = eeprom_rd_byte(address++);
+			
+			if (!app_regs_content_is_in_range(index, type, content, 1))
+				return false;
+		}
+	}
+	
+	/* Copy the image to the registers */
+	address = PAYLOAD_ADDRESS;
+	
+	for (uint8_t i = 0; i < CONFIG_N_REGS; i++)
+	{
+		uint8_t index = reg_index(i);
+		uint8_t *reg = app_regs_pointer[index];
+		
+		for (uint8_t j = reg_length(index); j; j--)
+			*reg++ = eeprom_rd_byte(address++);
+	}
+	
+	return true;
+}
+
+/************************************************************************/
+/* Deferred writer, called every millisecond                            */
+/*                                                                      */
+/* The version is cleared first and written last, so an image cut by a  */
+/* power loss is never loaded. The payload is read from the registers   */
+/* byte by byte and the CRC covers exactly what was written.            */
+/************************************************************************/
+#define STEP_IDLE                   0
+#define STEP_INVALIDATE             1
+#define STEP_PAYLOAD                2
+#define STEP_ERASE                  0xFFFF
+
+/* A full payload takes more than 255 steps */
+static uint16_t save_step = STEP_IDLE;
+static uint8_t save_reg;            // Position on config_regs[] of the register being written
+static uint8_t save_byte;           // Byte of that register
+static uint16_t save_crc;
+
+void config_image_task(void)
+{
+	uint8_t length = payload_length();
+	uint8_t index;
+	uint8_t byte;
+	
+	if (save_step == STEP_IDLE || eeprom_busy)
+		return;
+	
+	if (save_step == STEP_ERASE || save_step == STEP_INVALIDATE)
+	{
+		eeprom_wr_byte(VERSION_ADDRESS, 0xFF);
+		
+		save_step = (save_step == STEP_ERASE) ? STEP_IDLE : STEP_PAYLOAD;
+		save_reg = 0;
+		save_byte = 0;
+		save_crc = 0xFFFF;
+	}
+	else if (save_step < STEP_PAYLOAD + length)
+	{
+		index = reg_index(save_reg);
+		byte = app_regs_pointer[index][save_byte];
+		
+		eeprom_wr_byte(PAYLOAD_ADDRESS + save_step - STEP_PAYLOAD, byte);
+		save_crc = _crc_ccitt_update(save_crc, byte);
+		
+		if (++save_byte == reg_length(index))
+		{
+			save_reg++;
+			save_byte = 0;
+		}
+		
+		save_step++;
+	}
+	else if (save_step == STEP_PAYLOAD + length)
+	{
+		eeprom_wr_byte(crc_address(length), save_crc & 0xFF);
+		save_step++;
+	}
+	else if (save_step == STEP_PAYLOAD + length + 1)
+	{
+		eeprom_wr_byte(crc_address(length) + 1, save_crc >> 8);
+		save_step++;
+	}
+	else if (save_step == STEP_PAYLOAD + length + 2)
+	{
+		eeprom_wr_byte(LENGTH_ADDRESS, length);
+		save_step++;
+	}
+	else
+	{
+		eeprom_wr_byte(VERSION_ADDRESS, CONFIG_IMAGE_VERSION);
+		save_step = STEP_IDLE;
+	}
+}
+
+/************************************************************************/
+/* Commands                                                             */
+/************************************************************************/
+/* The writer runs at LOW level, the step is accessed in two bytes */
+static void set_save_step(uint16_t step)
+{
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	
+	PMIC.CTRL = pmic_ctrl & ~PMIC_LOLVLEN_bm;
+	save_step = step;
+	PMIC.CTRL = pmic_ctrl;
+}
+
+void config_image_save(void)
+{
+	set_save_step(STEP_INVALIDATE);
+}
+
+void config_image_erase(void)
+{
+	set_save_step(STEP_ERASE);
+}
+
+bool config_image_is_saving(void)
+{
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	uint16_t step;
+	
+	PMIC.CTRL = pmic_ctrl & ~PMIC_LOLVLEN_bm;
+	step = save_step;
+	PMIC.CTRL = pmic_ctrl;
+	
+	return (step != STEP_IDLE) && (step != STEP_ERASE);
+}
@@ -0,0 +1,42 @@
+#ifndef _CONFIG_IMAGE_H_
+#define _CONFIG_IMAGE_H_
+#include <avr/io.h>
+#include "app.h"
+
+
+/************************************************************************/
+/* Configuration image                                                  */
+/*                                                                      */
+/* Copy of the match tables, the rules, the notifications' and the     */
+/* reader's setup on the EEPROM, loaded in bulk at boot, so the reader  */
+/* is ready without the host writing these registers again after a      */
+/* power cycle. It takes precedence over the defaults and the core's    */
+/* EEPROM at boot only, a reset from the host doesn't load it.          */
+/*                                                                      */
+/* Layout: version, payload's length, payload, CRC-16 (CCITT)           */
+/* The payload is the content of the registers listed on config_image.c */
+/* in that order. Bump the version whenever the list changes.           */
+/*                                                                      */
+/* It takes the end of the EEPROM, after the detection log.             */
+/************************************************************************/
+#define CONFIG_IMAGE_EEPROM_START   0x0300
+#define CONFIG_IMAGE_EEPROM_SIZE    0x0100
+#define CONFIG_IMAGE_VERSION        16
+
+#if CONFIG_IMAGE_EEPROM_START + CONFIG_IMAGE_EEPROM_SIZE > EEPROM_SIZE
+	#error "The configuration image doesn't fit on the EEPROM"
+#endif
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+bool config_image_load(void);
+void config_image_task(void);
+
+void config_image_save(void);
+void config_image_erase(void);
+bool config_image_is_saving(void);
+
+
+#endif /* _CONFIG_IMAGE_H_ */
@@ -0,0 +1,232 @@
+#include <stddef.h>
+#include <string.h>
+#include <avr/xmega.h>
+#include "cpu.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "detection_log.h"
+
+_Static_assert(sizeof(detection_log_record_t) == DETECTION_LOG_RECORD_SIZE, "DETECTION_LOG_RECORD_SIZE");
+
+
+/************************************************************************/
+/* EEPROM layout                                                        */
+/************************************************************************/
+#define slot_address(slot)     (DETECTION_LOG_EEPROM_START + (uint16_t)(slot) * DETECTION_LOG_RECORD_SIZE)
+#define slot_add(slot, n)      (((slot) + (n)) % DETECTION_LOG_SLOTS)
+#define slot_sub(slot, n)      (((slot) + DETECTION_LOG_SLOTS - (n)) % DETECTION_LOG_SLOTS)
+#define next_slot(slot)        slot_add(slot, 1)
+#define ADDRESS_OFFSET         offsetof(detection_log_record_t, address)
+#define SEQ_OFFSET             offsetof(detection_log_record_t, seq)
+
+/************************************************************************/
+/* Queue and log state                                                  */
+/*                                                                      */
+/* The LOW level (the task) and the HIGH level (the host's reads and    */
+/* acknowledges) share the log's state, the task changes it with the    */
+/* interrupts disabled.                                                 */
+/************************************************************************/
+static detection_log_record_t queue;    // Next record
+static bool queue_is_full = false;
+
+static uint8_t log_head = 0;        // Slot of the next record
+static uint8_t log_tail = 0;        // Oldest record not acknowledged
+static uint8_t log_pending = 0;     // Records on the EEPROM not acknowledged
+static uint8_t log_unmarked = 0;    // Acknowledged records not yet marked as drained on the EEPROM
+static uint8_t log_seq = 0;
+
+static uint8_t open_address = 0;    // Address of the record written on log_head, 0 if none
+static bool log_is_ready = false;   // The layout byte is written
+
+static bool address_is_event(uint8_t address)
+{
+	return (address == ADD_REG_TAG_ID_ARRIVED) || (address == ADD_REG_TAG_ID_LEAVED);
+}
+
+/************************************************************************/
+/* Find the log on the EEPROM                                           */
+/************************************************************************/
+void detection_log_init(void)
+{
+	uint8_t slot;
+	uint8_t seq;
+	uint8_t next_seq;
+
+	/* Another layout, every slot is marked as drained first */
+	if (eeprom_rd_byte(DETECTION_LOG_EEPROM_LAYOUT) != DETECTION_LOG_LAYOUT_VERSION)
+	{
+		log_unmarked = DETECTION_LOG_SLOTS;
+		return;
+	}
+
+	/* The newest record is the one not followed by the next sequence number */
+	seq = eeprom_rd_byte(slot_address(0) + SEQ_OFFSET);
+
+	for (slot = 0; slot < DETECTION_LOG_SLOTS - 1; slot++)
+	{
+		next_seq = eeprom_rd_byte(slot_address(slot + 1) + SEQ_OFFSET);
+
+		if (next_seq != (uint8_t)(seq + 1))
+			break;
+
+		seq = next_seq;
+	}
+
+	log_seq = seq + 1;
+	log_head = next_slot(slot);
+
+	/* The drained records are the oldest ones */
+	log_tail = log_head;
+	log_pending = DETECTION_LOG_SLOTS;
+
+	while (log_pending && !address_is_event(eeprom_rd_byte(slot_address(log_tail) + ADDRESS_OFFSET)))
+	{
+		log_tail = next_slot(log_tail);
+		log_pending--;
+	}
+
+	log_is_ready = true;
+}
+
+/************************************************************************/
+/* Deferred writer, called every millisecond                            */
+/*                                                                      */
+/* The record goes to the page buffer with address = 0 and is written   */
+/* in one operation, then its address. A record cut by a power loss     */
+/* keeps address = 0 and is never drained.                              */
+/************************************************************************/
+static void write_record(uint16_t eeprom_address, detection_log_record_t *record)
+{
+	uint8_t sreg = SREG;
+	uint8_t *bytes = (uint8_t*)record;
+
+	/* The core also writes the EEPROM, the page buffer is never left loaded */
+	cli();
+
+	NVM.CMD = NVM_CMD_LOAD_EEPROM_BUFFER_gc;
+	NVM.ADDR1 = (uint8_t)(eeprom_address >> 8);
+	NVM.ADDR2 = 0;
+
+	for (uint8_t i = 0; i < DETECTION_LOG_RECORD_SIZE; i++)
+	{
+		NVM.ADDR0 = (uint8_t)(eeprom_address + i);
+		NVM.DATA0 = (i == ADDRESS_OFFSET) ? 0 : bytes[i];
+	}
+
+	NVM.ADDR0 = (uint8_t)eeprom_address;
+	NVM.CMD = NVM_CMD_ERASE_WRITE_EEPROM_PAGE_gc;
+	ccp_write_io((uint8_t*)&NVM.CTRLA, NVM_CMDEX_bm);
+
+	SREG = sreg;
+}
+
+void detection_log_task(void)
+{
+	uint8_t sreg = SREG;
+
+	if (eeprom_busy)
+		return;
+
+	if (open_address)
+	{
+		/* Close the record, the host can read it now */
+		eeprom_wr_byte(slot_address(log_head) + ADDRESS_OFFSET, open_address);
+
+		cli();
+		open_address = 0;
+		log_head = next_slot(log_head);
+		log_pending++;
+		SREG = sreg;
+	}
+	else if (queue_is_full)
+	{
+		cli();
+
+		/* If the log is full, the oldest record is lost */
+		if (log_pending == DETECTION_LOG_SLOTS)
+		{
+			log_tail = next_slot(log_tail);
+			log_pending--;
+		}
+
+		/* The slot will be overwritten, no need to mark it as drained */
+		if (log_unmarked && log_head == slot_sub(log_tail, log_unmarked))
+			log_unmarked--;
+
+		queue.seq = log_seq++;
+		open_address = queue.address;
+		SREG = sreg;
+
+		write_record(slot_address(log_head), &queue);
+		queue_is_full = false;
+	}
+	else if (log_unmarked)
+	{
+		eeprom_wr_byte(slot_address(slot_sub(log_tail, log_unmarked)) + ADDRESS_OFFSET, 0);
+
+		cli();
+		log_unmarked--;
+		SREG = sreg;
+	}
+	else if (!log_is_ready)
+	{
+		eeprom_wr_byte(DETECTION_LOG_EEPROM_LAYOUT, DETECTION_LOG_LAYOUT_VERSION);
+		log_is_ready = true;
+	}
+}
+
+/************************************************************************/
+/* Add a record, it's lost if the previous one is still waiting         */
+/************************************************************************/
+void detection_log_append(uint8_t address, uint64_t tag_id, timestamp_t *timestamp)
+{
+	if (queue_is_full || !log_is_ready)
+		return;
+
+	queue.tag_id = tag_id;
+	queue.second = timestamp->second;
+	queue.usecond = timestamp->usecond;
+	queue.address = address;
+	queue_is_full = true;
+}
+
+/************************************************************************/
+/* Drain                                                                */
+/************************************************************************/
+uint8_t detection_log_pending(void)
+{
+	return log_pending;
+}
+
+void detection_log_read(uint8_t *records, uint8_t n_records)
+{
+	uint8_t slot = log_tail;
+
+	memset(records, 0, n_records * DETECTION_LOG_RECORD_SIZE);
+
+	if (n_records > log_pending)
+		n_records = log_pending;
+
+	for (uint8_t i = 0; i < n_records; i++)
+	{
+		for (uint8_t j = 0; j < DETECTION_LOG_RECORD_SIZE; j++)
+			*records++ = eeprom_rd_byte(slot_address(slot) + j);
+
+		slot = next_slot(slot);
+	}
+}
+
+/* Takes the records up to seq, nothing if it's not one of the pending records */
+void detection_log_ack(uint8_t seq)
+{
+	/* The pending records are the ones before the record being written */
+	uint8_t tail_seq = log_seq - log_pending - (open_address ? 1 : 0);
+	uint8_t n_records = seq - tail_seq + 1;
+
+	if (n_records == 0 || n_records > log_pending)
+		return;
+
+	log_tail = slot_add(log_tail, n_records);
+	log_pending -= n_records;
+	log_unmarked += n_records;
+}
@@ -0,0 +1,73 @@
+#ifndef _DETECTION_LOG_H_
+#define _DETECTION_LOG_H_
+#include <avr/io.h>
+#include "hwbp_core.h"
+#include "app.h"
+#include "config_image.h"
+
+
+/************************************************************************/
+/* Detection log                                                        */
+/*                                                                      */
+/* Circular log of the detection events on the EEPROM, so they survive  */
+/* host outages and resets. It takes the EEPROM from the end of the     */
+/* core's registers to the configuration image.                         */
+/*                                                                      */
+/* The next record waits in SRAM and is written by detection_log_task() */
+/* in two operations of the EEPROM's page buffer, so nobody waits for   */
+/* the EEPROM: the record with address = 0, then its address. Each slot */
+/* is written in turn, spreading the wear over the whole area, and the  */
+/* position of the newest record is found at boot from the sequence    */
+/* numbers, so there's no fixed header to wear out.                     */
+/*                                                                      */
+/* The host reads DETECTION_LOG_RECORDS_PER_READ records at a time and  */
+/* acknowledges them with the sequence number of the newest one it got, */
+/* so an acknowledge that arrives after the log overwrote the oldest    */
+/* records never takes records the host didn't read.                    */
+/*                                                                      */
+/* The layout byte tells a log left by a firmware with another layout,  */
+/* which is cleared before the log takes records.                       */
+/************************************************************************/
+#define DETECTION_LOG_EEPROM_LAYOUT     0x006F
+#define DETECTION_LOG_EEPROM_START      0x0070
+#define DETECTION_LOG_SLOTS             41
+#define DETECTION_LOG_RECORD_SIZE       16          // A slot, within a page of the EEPROM
+#define DETECTION_LOG_RECORDS_PER_READ  2
+#define DETECTION_LOG_LAYOUT_VERSION    1
+
+#if CORE_EEPROM_APP_REGS + APP_NBYTES_TO_SAVE > DETECTION_LOG_EEPROM_LAYOUT
+	#error "The core's registers on the EEPROM overlap the detection log"
+#endif
+
+#if DETECTION_LOG_EEPROM_START + DETECTION_LOG_SLOTS * DETECTION_LOG_RECORD_SIZE > CONFIG_IMAGE_EEPROM_START
+	#error "The detection log overlaps the configuration image"
+#endif
+
+#if (DETECTION_LOG_EEPROM_START % DETECTION_LOG_RECORD_SIZE) || (EEPROM_PAGE_SIZE % DETECTION_LOG_RECORD_SIZE)
+	#error "The detection log's slots must not cross the EEPROM's pages"
+#endif
+
+typedef struct
+{
+	uint64_t tag_id;
+	uint32_t second;
+	uint16_t usecond;
+	uint8_t address;		// Event's register, 0 if the slot was already drained
+	uint8_t seq;
+} detection_log_record_t;
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void detection_log_init(void);
+void detection_log_task(void);
+
+void detection_log_append(uint8_t address, uint64_t tag_id, timestamp_t *timestamp);
+
+uint8_t detection_log_pending(void);
+void detection_log_read(uint8_t *records, uint8_t n_records);
+void detection_log_ack(uint8_t seq);
+
+
+#endif /* _DETECTION_LOG_H_ */
@@ -0,0 +1,26 @@
+#include <string.h>
+#include "handler_time.h"
+
+extern AppRegs app_regs;
+
+
+/************************************************************************/
+/* Timer                                                                */
+/************************************************************************/
+void handler_time_start_timer(void)
+{
+	HANDLER_TIMER.CTRLA = TC_CLKSEL_OFF_gc;
+	HANDLER_TIMER.CTRLB = TC_WGMODE_NORMAL_gc;
+	HANDLER_TIMER.CNT = 0;
+	HANDLER_TIMER.PER = 0xFFFF;
+	HANDLER_TIMER.CTRLA = HANDLER_TIMER_CLKSEL;
+}
+
+void handler_time_reset(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	memset(app_regs.REG_HANDLER_TIMES, 0, sizeof(app_regs.REG_HANDLER_TIMES));
+	SREG = sreg;
+}
@@ -0,0 +1,83 @@
+#ifndef _HANDLER_TIME_H_
+#define _HANDLER_TIME_H_
+#include "cpu.h"
+#include "app_ios_and_regs.h"
+
+extern AppRegs app_regs;
+
+
+/************************************************************************/
+/* Handlers' worst time                                                 */
+/*                                                                      */
+/* Each level's handlers take HANDLER_TIMER's count when they start and */
+/* keep on REG_HANDLER_TIMES the longest they took, per level, in ticks */
+/* of 0.25 us. The time includes the higher levels that preempted the   */
+/* handler, so it's how long the level kept the lower ones waiting,     */
+/* less the prologue and epilogue (~1 us). These are the figures of the */
+/* latency budget on app.h:                                             */
+/*   HANDLER_HIGH: TAG_IN_RANGE edges and their glitch filter           */
+/*   HANDLER_MED:  a byte or a Wiegand bit of the first reader, or the  */
+/*                 self-test's byte, and a byte of the second reader    */
+/*   HANDLER_LOW:  the frame timeouts and the 1 ms tick                 */
+/*                                                                      */
+/* HANDLER_TIMER is OUT0_GATE_TIMER, free running while the gate is     */
+/* disabled. While it's enabled the handlers leave the timer alone,     */
+/* their 16 bits accesses would go through the TEMP register the gate's */
+/* writes use, and the times are not updated.                           */
+/************************************************************************/
+#define HANDLER_TIMER               TCD0        // 0.25 us per tick, wraps at 16 ms
+#define HANDLER_TIMER_CLKSEL        TC_CLKSEL_DIV8_gc
+
+#define HANDLER_HIGH                0
+#define HANDLER_MED                 1
+#define HANDLER_LOW                 2
+
+#define handler_timer_is_free       (HANDLER_TIMER.CTRLA == HANDLER_TIMER_CLKSEL)
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+/* Called at boot and when the gate is disabled */
+void handler_time_start_timer(void);
+void handler_time_reset(void);
+
+
+/************************************************************************/
+/* Measure                                                              */
+/*                                                                      */
+/* Inlined, as the handlers calling them are in the latency budget.     */
+/* The count is read with the interrupts disabled, as a handler of a    */
+/* higher level would overwrite the TEMP register between its bytes.    */
+/************************************************************************/
+static inline uint16_t handler_time_start(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t ticks = 0;
+	
+	cli();
+	if (handler_timer_is_free)
+		ticks = HANDLER_TIMER.CNT;
+	SREG = sreg;
+	
+	return ticks;
+}
+
+static inline void handler_time_stop(uint8_t level, uint16_t start)
+{
+	uint8_t sreg = SREG;
+	uint16_t ticks;
+	
+	cli();
+	if (handler_timer_is_free)
+	{
+		ticks = HANDLER_TIMER.CNT - start;
+		
+		if (ticks > app_regs.REG_HANDLER_TIMES[level])
+			app_regs.REG_HANDLER_TIMES[level] = ticks;
+	}
+	SREG = sreg;
+}
+
+
+#endif /* _HANDLER_TIME_H_ */
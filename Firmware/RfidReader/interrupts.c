@@ -3,12 +3,56 @@
 #include "app_ios_and_regs.h"
 #include "app_funcs.h"
 #include "hwbp_core.h"
+#include "u64_handoff.h"
+#include "detection_log.h"
+#include "uart0.h"
+#include "app.h"
+#include "reader_protocol.h"
+#include "wiegand.h"
+#include "reader.h"
+#include "stats.h"
+#include "latency.h"
+#include "rules.h"
+#include "out0_gate.h"
+#include "work.h"
+#include "self_test.h"
+#include "handler_time.h"
 
 /************************************************************************/
 /* Declare application registers                                        */
 /************************************************************************/
 extern AppRegs app_regs;
 
+/************************************************************************/
+/* Tag ID registers                                                     */
+/*                                                                      */
+/* The handoff keeps a copy of the value while it's written to the      */
+/* registers' bank, so the read callbacks always get a complete value.  */
+/* They run on the core's command handler, at HIGH level, which         */
+/* preempts the main loop even with the LOW level masked.               */
+/************************************************************************/
+extern u64_handoff_t tag_id_arrived;
+extern u64_handoff_t tag_id_leaved;
+
+static void update_tag_id_arrived(uint64_t tag_id)
+{
+	u64_handoff_write(&tag_id_arrived, &app_regs.REG_TAG_ID_ARRIVED, tag_id);
+}
+
+static void update_tag_id_leaved(uint64_t tag_id)
+{
+	u64_handoff_write(&tag_id_leaved, &app_regs.REG_TAG_ID_LEAVED, tag_id);
+}
+
+/************************************************************************/
+/* Keep the detection events on the EEPROM if the log is enabled        */
+/************************************************************************/
+static void log_detection(uint8_t add, uint64_t tag_id, timestamp_t *timestamp)
+{
+	if (app_regs.REG_DETECTION_LOG_CONFIG & B_LOG_EN)
+		detection_log_append(add, tag_id, timestamp);
+}
+
 /************************************************************************/
 /* Interrupts from Timers                                               */
 /************************************************************************/
@@ -36,241 +80,646 @@ ISR(PORTA_INT0_vect, ISR_NAKED)
 
 /************************************************************************/ 
 /* TAG_IN_RANGE                                                         */
+/*                                                                      */
+/* Runs at HIGH level and only captures the timestamps. The events are  */
+/* sent from LOW level code, so the core is never reentered             */
+/*                                                                      */
+/* The rising edge may also start OUT0's pulse right away, so it        */
+/* doesn't wait for the frame. Its event and the notifications follow   */
+/* on the next 1 ms tick.                                               */
+/*                                                                      */
+/* With REG_TAG_IN_RANGE_FILTER, an edge only counts if the line stays  */
+/* at the new level for the minimum time of that direction, checked by  */
+/* TAG_IN_RANGE_FILTER_TIMER. The edge keeps the timestamp of the first */
+/* transition, the ones that don't last are counted as glitches.        */
 /************************************************************************/
-extern bool id_event_was_sent;
+extern void capture_timestamp(volatile timestamp_t *timestamp);
+extern void send_event_at(uint8_t add, timestamp_t *timestamp);
 
-uint64_t id_leaved_temp = 0;
+volatile timestamp_t tag_in_range_timestamp;
+volatile timestamp_t tag_left_range_timestamp;
+volatile uint8_t tag_in_range_edges = 0;
+volatile bool tag_left_range = false;
+volatile bool tag_entered_range = false;
+volatile bool out0_set_on_edge = false;
 
-ISR(PORTC_INT0_vect, ISR_NAKED)
+static bool tag_in_range_level = false;    // After the filter
+static bool edge_is_pending = false;
+static timestamp_t pending_edge_timestamp;
+
+static void accept_edge(bool rising, timestamp_t *timestamp)
 {
-	if (read_TAG_IN_RANGE)
+	tag_in_range_level = rising;
+	
+	if (rising)
 	{
-		core_func_mark_user_timestamp();
+		tag_in_range_timestamp.second = timestamp->second;
+		tag_in_range_timestamp.usecond = timestamp->usecond;
+		tag_entered_range = true;
+		
+		if (!out0_gate_is_enabled() && app_regs.REG_TAG_PRESENT_OUT0_PERIOD && !read_OUT0)
+		{
+			set_OUT0;
+			if (core_bool_is_visual_enabled())
+				set_LED_OUT0;
+			out0_set_on_edge = true;
+		}
 	}
 	else
 	{
-		if (id_event_was_sent)
-		{
-			id_event_was_sent = false;
-			
-			if (app_regs.REG_TAG_ID_ARRIVED != 0)		// if != 0 it's a 125 KHz antenna
-			{
-				app_regs.REG_TAG_ID_LEAVED = app_regs.REG_TAG_ID_ARRIVED;
-				core_func_send_event(ADD_REG_TAG_ID_LEAVED, true);
-				app_regs.REG_TAG_ID_ARRIVED = 0;
-			}
-		}
-	}	
+		tag_left_range_timestamp.second = timestamp->second;
+		tag_left_range_timestamp.usecond = timestamp->usecond;
+		tag_left_range = true;
+		out0_gate_edge(false);
+	}
 	
-	reti();
+	tag_in_range_edges++;
 }
 
-/************************************************************************/
-/* UART0                                                                */
-/************************************************************************/
-extern uint8_t rxbuff_pointer;
-extern uint8_t rxbuff_uart0[];
+/* Called when the filter is configured */
+void reset_tag_in_range_filter(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	timer_type0_stop(&TAG_IN_RANGE_FILTER_TIMER);
+	edge_is_pending = false;
+	tag_in_range_level = read_TAG_IN_RANGE;
+	SREG = sreg;
+}
 
-extern uint16_t out0_timeout_ms;
+static void tag_in_range_edge(void)
+{
+	timestamp_t timestamp;
+	bool rising = read_TAG_IN_RANGE;
+	uint16_t stable_ms = app_regs.REG_TAG_IN_RANGE_FILTER[rising ? 0 : 1];
+	
+	capture_timestamp(&timestamp);
+	
+	/* The event system sees every edge, the gate must be disarmed anyway */
+	if (rising)
+		out0_gate_edge(true);
+	
+	/* Back to the accepted level before the minimum time */
+	if (edge_is_pending)
+	{
+		timer_type0_stop(&TAG_IN_RANGE_FILTER_TIMER);
+		edge_is_pending = false;
+		
+		if (app_regs.REG_TAG_IN_RANGE_GLITCHES < 0xFFFF)
+			app_regs.REG_TAG_IN_RANGE_GLITCHES++;
+		
+		if (rising == tag_in_range_level)
+			return;
+	}
+	
+	if (stable_ms == 0)
+	{
+		accept_edge(rising, &timestamp);
+	}
+	else
+	{
+		pending_edge_timestamp = timestamp;
+		edge_is_pending = true;
+		timer_type0_enable(&TAG_IN_RANGE_FILTER_TIMER, TIMER_PRESCALER_DIV1024, ((uint32_t)stable_ms * 125) / 4, TAG_IN_RANGE_INT_LEVEL);
+	}
+}
 
-extern void notify(uint8_t notify_mask);
+ISR(PORTC_INT0_vect)
+{
+	uint16_t start = handler_time_start();
+	
+	tag_in_range_edge();
+	handler_time_stop(HANDLER_HIGH, start);
+}
+
+ISR(TCE0_OVF_vect)
+{
+	uint16_t start = handler_time_start();
+	
+	timer_type0_stop(&TAG_IN_RANGE_FILTER_TIMER);
+	edge_is_pending = false;
+	
+	/* Only if the line is still at the new level */
+	if (read_TAG_IN_RANGE != tag_in_range_level)
+		accept_edge(!tag_in_range_level, &pending_edge_timestamp);
+	
+	handler_time_stop(HANDLER_HIGH, start);
+}
 
-uint8_t reverse_byte(uint8_t num)
+/* Copy a timestamp captured on the edges, again if an edge arrived meanwhile */
+static void read_edge_timestamp(timestamp_t *timestamp, volatile timestamp_t *edge_timestamp)
 {
-    uint8_t NO_OF_BITS = 8;
-    uint8_t reverse_num = 0;
-    uint8_t i;
-	 
-    for (i = 0; i < NO_OF_BITS; i++)
-	 {
-        if ((num & (1 << i)))
-		  {
-            reverse_num |= 1 << ((NO_OF_BITS - 1) - i);
-		  }
-    }
-    return reverse_num;
+	uint8_t edges;
+	
+	do
+	{
+		edges = tag_in_range_edges;
+		timestamp->second = edge_timestamp->second;
+		timestamp->usecond = edge_timestamp->usecond;
+	} while (edges != tag_in_range_edges);
 }
 
-ISR(TCD1_OVF_vect, ISR_NAKED)
+extern uint16_t out0_timeout_ms;
+
+extern void notify(uint8_t notify_mask);
+
+/* Called from the 1 ms tick (LOW level) when a tag entered the range */
+/* Its ID is not known yet                                            */
+void process_tag_entered_range(void)
 {
-	/* Stop timer */
-	timer_type1_stop(&TCD1);
+	timestamp_t timestamp;
+	
+	if (app_regs.REG_EVENT_CONFIG & B_PRESENT_EN)
+	{
+		read_edge_timestamp(&timestamp, &tag_in_range_timestamp);
+		app_regs.REG_TAG_PRESENT = 1;
+		send_event_at(ADD_REG_TAG_PRESENT, &timestamp);
+	}
 	
-	/* 16 payload bytes
+	notify(app_regs.REG_TAG_PRESENT_NOTIFICATIONS);
 	
-	      * Card format: 125 kHz nominal carrier (EM 4001 or compatible)
-	      * Payload: 10 ASCII (5 bytes)
-	      * Checksum: 2 ASCII (1 byte)
-			
-	   30 payload bytes
+	/* Don't cut a longer pulse */
+	if (out0_timeout_ms < app_regs.REG_TAG_PRESENT_OUT0_PERIOD)
+		out0_timeout_ms = app_regs.REG_TAG_PRESENT_OUT0_PERIOD;
+	
+	if (out0_set_on_edge)
+	{
+		out0_set_on_edge = false;
+		app_regs.REG_OUT = B_OUT0;
+		core_func_send_event(ADD_REG_OUT, true);
 		
-	      * Card format: ISO11785
-	      * Payload: 16 ASCII (8 bytes)
-	      * Checksum: 4 ASCII (2 byte)
-	      * Extension bits: 6 ASCII (3 bytes)
-	*/
+		/* The period was cleared meanwhile, the pulse must still end */
+		if (out0_timeout_ms == 0)
+			out0_timeout_ms = 1;
+	}
+}
+
+/* Queued by the 1 ms tick when the tag left the range, done on the main loop */
+/* TAG_IN_RANGE belongs to the first reader                           */
+void process_tag_left_range(void)
+{
+	reader_t *reader = &readers[0];
+	timestamp_t timestamp;
 	
-	if (rxbuff_pointer == 16 || rxbuff_pointer == 30)
+	if (reader->id_event_was_sent)
 	{
-		/* Check message start */
-		if (rxbuff_uart0[0] != 0x02) return;	// STX
+		reader->id_event_was_sent = false;
 		
-		/* Check message termination */
-		if (rxbuff_uart0[rxbuff_pointer - 3] != 0x0D) return;	// CR
-		if (rxbuff_uart0[rxbuff_pointer - 2] != 0x0A) return;	// LF
-		if (rxbuff_uart0[rxbuff_pointer - 1] != 0x03) return;	// ETX
+		uint64_t tag_id = reader->tag_id;
 		
-		/* Convert from ASCII */
-		for (uint8_t i = 1; i < rxbuff_pointer - 4 + 1; i++)
+		/* The arrival was suppressed, so is the leave */
+		if (tag_id != 0 && reader->events_are_suppressed)
 		{
-			if (rxbuff_uart0[i] <= 57)
-				rxbuff_uart0[i] = rxbuff_uart0[i] - 48;
-			else
-				rxbuff_uart0[i] = rxbuff_uart0[i] - 65 + 10;
+			reader->tag_id = 0;
+			update_tag_id_arrived(0);
 		}
-		for (uint8_t i = 0; i < (rxbuff_pointer - 4 + 1) / 2; i++)
+		else if (tag_id != 0)		// if != 0 it's a 125 KHz antenna
 		{
-			rxbuff_uart0[i] = (rxbuff_uart0[i*2+1] << 4) + rxbuff_uart0[i*2+2];
-		}
-		
-		/* Confirm checksum */
-		if (rxbuff_pointer == 16)
-		{
-			uint8_t checksum = rxbuff_uart0[0] ^ rxbuff_uart0[1] ^ rxbuff_uart0[2] ^ rxbuff_uart0[3] ^ rxbuff_uart0[4];
+			reader->tag_id = 0;
+			update_tag_id_leaved(tag_id);
+			read_edge_timestamp(&timestamp, &tag_left_range_timestamp);
 			
-			if (checksum != rxbuff_uart0[5])
+			if (app_regs.REG_EVENT_CONFIG & B_QUALITY_EN)
 			{
-					rxbuff_pointer = 0;	
-					reti();
+				reader_presence_report(reader, app_regs.REG_PRESENCE_QUALITY);
+				send_event_at(ADD_REG_PRESENCE_QUALITY, &timestamp);
 			}
-		}
-		else
-		{
-			// Checksum confirmation for ISO11785 not implemented yet
-		}
-		
-		/* Convert tag ID to the 64 bits register */
-		if (rxbuff_pointer == 16)
-		{
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+0) = rxbuff_uart0[4];
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+1) = rxbuff_uart0[3];
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+2) = rxbuff_uart0[2];
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+3) = rxbuff_uart0[1];
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+4) = rxbuff_uart0[0];
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+5) = 0;
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+6) = 0;
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+7) = 0;
 			
-			id_leaved_temp = app_regs.REG_TAG_ID_ARRIVED;
-		}
-		else
-		{
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+0) = reverse_byte(rxbuff_uart0[0]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+1) = reverse_byte(rxbuff_uart0[1]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+2) = reverse_byte(rxbuff_uart0[2]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+3) = reverse_byte(rxbuff_uart0[3]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+4) = reverse_byte(rxbuff_uart0[4]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+5) = reverse_byte(rxbuff_uart0[5]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+6) = reverse_byte(rxbuff_uart0[6]);
-			*(((uint8_t*)(&app_regs.REG_TAG_ID_ARRIVED))+7) = reverse_byte(rxbuff_uart0[7]);
-			
-			uint64_t id           = (app_regs.REG_TAG_ID_ARRIVED & 0x3FFFFFFFFF);
- 			uint64_t country_code = (app_regs.REG_TAG_ID_ARRIVED & 0xFFC000000000) >> 38;
-			 
-			app_regs.REG_TAG_ID_ARRIVED = country_code * 1000000000000 + id;
-		}
-		
-		/* Check for matching */
-		if ((app_regs.REG_TAG_MATCH0 != 0) || (app_regs.REG_TAG_MATCH1 != 0) || (app_regs.REG_TAG_MATCH2 != 0) || (app_regs.REG_TAG_MATCH3 != 0 ))
-		{
-			if (app_regs.REG_TAG_ID_ARRIVED == app_regs.REG_TAG_MATCH0)
+			if ((app_regs.REG_EVENT_CONFIG & B_MATCH_INDEX_EN) && reader->match_index != MATCH_NONE)
 			{
-				core_func_send_event(ADD_REG_TAG_ID_ARRIVED, (rxbuff_pointer == 16) ? false : true);
-				if (rxbuff_pointer == 30)
-				{
-					app_regs.REG_TAG_ID_ARRIVED = 0;
-					app_regs.REG_TAG_ID_LEAVED = 0;
-				}
-				
-				id_event_was_sent = true;
-				notify(app_regs.REG_NOTIFICATIONS);
-				out0_timeout_ms = app_regs.REG_TAG_MATCH0_OUT0_PERIOD;
-				return;				
+				app_regs.REG_MATCH_INDEX_LEAVED = reader->match_index;
+				send_event_at(ADD_REG_MATCH_INDEX_LEAVED, &timestamp);
 			}
-			if (app_regs.REG_TAG_ID_ARRIVED == app_regs.REG_TAG_MATCH1)
-			{
-				core_func_send_event(ADD_REG_TAG_ID_ARRIVED, (rxbuff_pointer == 16) ? false : true);
-				if (rxbuff_pointer == 30)
-				{
-					app_regs.REG_TAG_ID_ARRIVED = 0;
-					app_regs.REG_TAG_ID_LEAVED = 0;
-				}
-				
-				id_event_was_sent = true;
-				notify(app_regs.REG_NOTIFICATIONS);
-				out0_timeout_ms = app_regs.REG_TAG_MATCH1_OUT0_PERIOD;
-				return;
-			}
-			if (app_regs.REG_TAG_ID_ARRIVED == app_regs.REG_TAG_MATCH2)
-			{
-				core_func_send_event(ADD_REG_TAG_ID_ARRIVED, (rxbuff_pointer == 16) ? false : true);
-				if (rxbuff_pointer == 30)
-				{
-					app_regs.REG_TAG_ID_ARRIVED = 0;
-					app_regs.REG_TAG_ID_LEAVED = 0;
-				}
-				
-				id_event_was_sent = true;
-				notify(app_regs.REG_NOTIFICATIONS);
-				out0_timeout_ms = app_regs.REG_TAG_MATCH2_OUT0_PERIOD;
-				return;
-			}
-			if (app_regs.REG_TAG_ID_ARRIVED == app_regs.REG_TAG_MATCH3)
+			else
 			{
-				core_func_send_event(ADD_REG_TAG_ID_ARRIVED, (rxbuff_pointer == 16) ? false : true);
-				if (rxbuff_pointer == 30)
-				{
-					app_regs.REG_TAG_ID_ARRIVED = 0;
-					app_regs.REG_TAG_ID_LEAVED = 0;
-				}
-				
-				id_event_was_sent = true;
-				notify(app_regs.REG_NOTIFICATIONS);
-				out0_timeout_ms = app_regs.REG_TAG_MATCH3_OUT0_PERIOD;
-				return;
+				send_event_at(ADD_REG_TAG_ID_LEAVED, &timestamp);
 			}
+			
+			log_detection(ADD_REG_TAG_ID_LEAVED, tag_id, &timestamp);
+			update_tag_id_arrived(0);
 		}
-		else
+	}
+}
+
+/************************************************************************/
+/* Readers                                                              */
+/************************************************************************/
+/* Tags seen through TAG_IN_RANGE are stamped with its rising edge */
+static void detection_timestamp(uint8_t flags, timestamp_t *timestamp)
+{
+	if (flags & PROTOCOL_IN_RANGE_bm)
+		read_edge_timestamp(timestamp, &tag_in_range_timestamp);
+	else
+		capture_timestamp(timestamp);
+}
+
+/* Matching tags can be sent as the index of the matching ID */
+static void send_tag_id_arrived(reader_t *reader, uint64_t tag_id, uint8_t match_index, timestamp_t *timestamp)
+{
+#if READER_COUNT > 1
+	app_regs.REG_TAG_ID_ANTENNA = reader->index;
+	send_event_at(ADD_REG_TAG_ID_ANTENNA, timestamp);
+#endif
+	
+	if ((app_regs.REG_EVENT_CONFIG & B_MATCH_INDEX_EN) && match_index != MATCH_NONE)
+	{
+		app_regs.REG_MATCH_INDEX_ARRIVED = match_index;
+		send_event_at(ADD_REG_MATCH_INDEX_ARRIVED, timestamp);
+	}
+	else
+	{
+		send_event_at(ADD_REG_TAG_ID_ARRIVED, timestamp);
+	}
+	
+	log_detection(ADD_REG_TAG_ID_ARRIVED, tag_id, timestamp);
+}
+
+static void send_tag_id_unmatched(uint64_t tag_id)
+{
+	timestamp_t timestamp;
+	
+	capture_timestamp(&timestamp);
+	app_regs.REG_TAG_ID_UNMATCHED = tag_id;
+	send_event_at(ADD_REG_TAG_ID_UNMATCHED, &timestamp);
+}
+
+/************************************************************************/
+/* Matching                                                             */
+/************************************************************************/
+/* Match tags only if there's at least one ID to match */
+static bool match_is_enabled(void)
+{
+	match_entry_t *table = (match_entry_t*)app_regs.REG_MATCH_TABLE;
+	
+	if ((app_regs.REG_TAG_MATCH0 != 0) || (app_regs.REG_TAG_MATCH1 != 0) || (app_regs.REG_TAG_MATCH2 != 0) || (app_regs.REG_TAG_MATCH3 != 0 ))
+		return true;
+	
+	for (uint8_t i = 0; i < MATCH_TABLE_SIZE; i++)
+		if (table[i].tag_id != 0)
+			return true;
+	
+	return false;
+}
+
+/* Returns the index of the matching ID, or MATCH_NONE */
+static uint8_t find_match(uint64_t tag_id, uint16_t *out0_period, uint8_t *notifications)
+{
+	match_entry_t *table = (match_entry_t*)app_regs.REG_MATCH_TABLE;
+	
+	/* REG_TAG_MATCH0..3 and their periods are consecutive on the registers' bank */
+	for (uint8_t i = 0; i < MATCH_TABLE_FIRST_INDEX; i++)
+	{
+		if (tag_id == (&app_regs.REG_TAG_MATCH0)[i])
 		{
-			core_func_send_event(ADD_REG_TAG_ID_ARRIVED, (rxbuff_pointer == 16) ? false : true);
-			if (rxbuff_pointer == 30)
-			{
-				app_regs.REG_TAG_ID_ARRIVED = 0;
-				app_regs.REG_TAG_ID_LEAVED = 0;
-			}
-			
-			id_event_was_sent = true;
-			out0_timeout_ms = app_regs.REG_TAG_ID_ARRIVED_PERIOD;
-			notify(app_regs.REG_NOTIFICATIONS);
-		}		
+			*out0_period = (&app_regs.REG_TAG_MATCH0_OUT0_PERIOD)[i];
+			*notifications = app_regs.REG_NOTIFICATIONS;
+			return i;
+		}
 	}
 	
-	rxbuff_pointer = 0;	
-	reti();
+	for (uint8_t i = 0; i < MATCH_TABLE_SIZE; i++)
+	{
+		if (tag_id == table[i].tag_id)
+		{
+			*out0_period = table[i].out0_period;
+			*notifications = table[i].notifications;
+			return MATCH_TABLE_FIRST_INDEX + i;
+		}
+	}
+	
+	return MATCH_NONE;
+}
+
+/* The limits of each table entry, taken from the detections' Harp time */
+typedef struct
+{
+	uint32_t activation_ms;          // Of the last activation
+	uint16_t window_start;           // Harp second the quota window started, low 16 bits
+	uint8_t activations;             // On the quota window, 0 if the limits are over
+} match_limits_t;
+
+static match_limits_t match_limits[MATCH_TABLE_SIZE];
+
+/* The usecond counts 32 us */
+static uint32_t harp_ms(timestamp_t *timestamp)
+{
+	return timestamp->second * 1000 + (uint32_t)timestamp->usecond * 32 / 1000;
+}
+
+/* Called when the table is written or loaded */
+void reset_match_limits(void)
+{
+	for (uint8_t i = 0; i < MATCH_TABLE_SIZE; i++)
+		match_limits[i].activations = 0;
+}
+
+/* Retires the limits that are over, so the differences above never wrap */
+/* Called from the new second (LOW level)                                 */
+void match_limits_new_second(void)
+{
+	match_entry_t *table = (match_entry_t*)app_regs.REG_MATCH_TABLE;
+	timestamp_t timestamp;
+	
+	capture_timestamp(&timestamp);
+	
+	for (uint8_t i = 0; i < MATCH_TABLE_SIZE; i++)
+	{
+		if (match_limits[i].activations == 0)
+			continue;
+		
+		if (harp_ms(&timestamp) - match_limits[i].activation_ms < table[i].refractory)
+			continue;
+		
+		if (table[i].quota && (uint16_t)(timestamp.second - match_limits[i].window_start) < table[i].quota_window)
+			continue;
+		
+		match_limits[i].activations = 0;
+	}
+}
+
+static bool activation_is_allowed(uint8_t match_index, timestamp_t *timestamp)
+{
+	match_entry_t *entry;
+	match_limits_t *limits;
+	uint32_t now_ms = harp_ms(timestamp);
+	bool is_allowed = true;
+	
+	/* Only the table has limits */
+	if (match_index == MATCH_NONE || match_index < MATCH_TABLE_FIRST_INDEX)
+		return true;
+	
+	entry = &((match_entry_t*)app_regs.REG_MATCH_TABLE)[match_index - MATCH_TABLE_FIRST_INDEX];
+	limits = &match_limits[match_index - MATCH_TABLE_FIRST_INDEX];
+	
+	if (limits->activations)
+	{
+		if (now_ms - limits->activation_ms < entry->refractory)
+			is_allowed = false;
+		
+		/* A new quota window starts on the first activation after this one is over */
+		else if (entry->quota && (uint16_t)(timestamp->second - limits->window_start) >= entry->quota_window)
+			limits->activations = 0;
+	}
+	
+	if (entry->quota && limits->activations >= entry->quota)
+		is_allowed = false;
+	
+	if (!is_allowed)
+	{
+		if (app_regs.REG_SUPPRESSED_ACTIVATIONS[match_index - MATCH_TABLE_FIRST_INDEX] < 0xFFFF)
+			app_regs.REG_SUPPRESSED_ACTIVATIONS[match_index - MATCH_TABLE_FIRST_INDEX]++;
+		return false;
+	}
+	
+	if (limits->activations == 0)
+		limits->window_start = (uint16_t)timestamp->second;
+	
+	if (limits->activations < 0xFF)
+		limits->activations++;
+	
+	limits->activation_ms = now_ms;
+	return true;
+}
+
+/* The rules may replace the OUT0 period and the notifications */
+/* and the limits of the matching ID may suppress them         */
+static void accept_tag_id(reader_t *reader, uint8_t flags, uint64_t tag_id, uint8_t match_index, uint16_t out0_period, uint8_t notifications)
+{
+	timestamp_t timestamp;
+	uint8_t actions;
+	
+	detection_timestamp(flags, &timestamp);
+	actions = rules_apply(match_index, timestamp.second, &out0_period, &notifications);
+	
+	if ((out0_period || notifications) && !activation_is_allowed(match_index, &timestamp))
+	{
+		out0_period = 0;
+		notifications = 0;
+	}
+	
+	if (!(actions & RULE_SUPPRESS_bm))
+	{
+		send_tag_id_arrived(reader, tag_id, match_index, &timestamp);
+		latency_event(out0_period != 0);
+	}
+	
+	/* Without TAG_IN_RANGE there's no leave event */
+	if (flags & PROTOCOL_IN_RANGE_bm)
+	{
+		reader->tag_id = tag_id;
+		reader->match_index = match_index;
+		reader->events_are_suppressed = actions & RULE_SUPPRESS_bm;
+		reader_presence_start(reader);
+	}
+	else
+	{
+		reader->tag_id = 0;
+		update_tag_id_arrived(0);
+		update_tag_id_leaved(0);
+	}
+	
+	reader->id_event_was_sent = true;
+	notify(notifications);
+	out0_timeout_ms = out0_period;
+}
+
+/************************************************************************/
+/* Frame timeout                                                        */
+/*                                                                      */
+/* Only takes the frame, the main loop does the rest (see work.h). The  */
+/* oldest queued frame is taken to REG_RAW_FRAME, its length followed   */
+/* by its bytes, so the raw frames are sent as they are. The frames     */
+/* queued behind it are held on their reader's buffers, in order.       */
+/************************************************************************/
+_Static_assert(sizeof(app_regs.REG_RAW_FRAME) == 1 + READER_RXBUFSIZ, "REG_RAW_FRAME");
+
+static reader_frame_t raw_frame_context;       // Of the frame on REG_RAW_FRAME
+static bool raw_frame_is_taken = false;        // Until its work is done
+
+static bool a_frame_is_held(void)
+{
+	for (uint8_t i = 0; i < READER_COUNT; i++)
+		if (readers[i].frame_is_held)
+			return true;
+	
+	return false;
+}
+
+static void take_frame(reader_t *reader)
+{
+	app_regs.REG_RAW_FRAME[0] = reader_take_frame(reader, &app_regs.REG_RAW_FRAME[1], &raw_frame_context);
+	raw_frame_is_taken = true;
+}
+
+static void queue_frame(reader_t *reader)
+{
+	uint8_t type = WORK_UART_FRAME;
+	
+	if (reader->index == 0 && app_regs.REG_READER_INTERFACE == GM_READER_WIEGAND)
+		type = WORK_WIEGAND_FRAME;
+	
+	/* Its bytes were not kept, the reader's buffer was held */
+	if (reader_frame_was_dropped(reader))
+	{
+		work_drop();
+		return;
+	}
+	
+	if (!work_alloc(type, reader->index))
+	{
+		reader_discard_frame(reader);
+		work_drop();
+		return;
+	}
+	
+	if (raw_frame_is_taken || a_frame_is_held())
+		reader_hold_frame(reader);
+	else
+		take_frame(reader);
+	
+	work_push();
+}
+
+ISR(TCD1_CCA_vect)
+{
+	uint16_t start = handler_time_start();
+	
+	reader_stop_timeout(&readers[0]);
+	queue_frame(&readers[0]);
+	handler_time_stop(HANDLER_LOW, start);
+}
+
+#if READER_COUNT > 1
+ISR(TCD1_CCB_vect)
+{
+	uint16_t start = handler_time_start();
+	
+	reader_stop_timeout(&readers[1]);
+	queue_frame(&readers[1]);
+	handler_time_stop(HANDLER_LOW, start);
+}
+#endif
+
+/************************************************************************/
+/* Bottom half                                                          */
+/************************************************************************/
+/* The frame was held on its reader's buffer, REG_RAW_FRAME is free now */
+void work_take(work_t *item)
+{
+	if (work_is_frame(item->type) && !raw_frame_is_taken)
+		take_frame(&readers[item->reader]);
+}
+
+/* Decoded on REG_RAW_FRAME, without touching the other registers */
+int8_t work_decode(work_t *item, uint64_t *tag_id)
+{
+	uint8_t *raw_frame = app_regs.REG_RAW_FRAME;
+	
+	if (item->type == WORK_WIEGAND_FRAME)
+		/* The module keeps driving TAG_IN_RANGE */
+		return wiegand_decode(&raw_frame[1], raw_frame[0], tag_id) ? PROTOCOL_IN_RANGE_bm : -1;
+	
+	if (item->type != WORK_UART_FRAME || raw_frame[0] == 0)
+		return -1;
+	
+	return reader_protocol_decode(&raw_frame[1], raw_frame[0], app_regs.REG_READER_PROTOCOLS, tag_id);
+}
+
+static void send_raw_frame(work_t *item, int8_t flags)
+{
+	if (item->type != WORK_UART_FRAME || app_regs.REG_RAW_FRAME[0] == 0 || !app_regs.REG_RAW_FRAME_CONFIG)
+		return;
+	
+	if ((app_regs.REG_RAW_FRAME_CONFIG & B_RAW_ALL) || (flags < 0 && (app_regs.REG_RAW_FRAME_CONFIG & B_RAW_UNDECODED)))
+		send_event_at(ADD_REG_RAW_FRAME, &raw_frame_context.timestamp);
+}
+
+static void process_frame(work_t *item, int8_t flags, uint64_t tag_id)
+{
+	reader_t *reader = &readers[item->reader];
+	
+	/* The synthetic frames stop here */
+	if (self_test_is_running())
+	{
+		self_test_frame(flags, tag_id);
+		return;
+	}
+	
+	/* Kept while the tag is in range, until its leave event */
+	if (reader->tag_id == 0)
+		update_tag_id_arrived(0);
+	
+	send_raw_frame(item, flags);
+	
+	if (flags < 0)
+	{
+		stats_frame_error();
+		reader_frame_error(reader);
+		
+		if (reader->tag_id != 0)
+			reader_presence_frame(reader, false);
+		return;
+	}
+	
+	latency_frame(raw_frame_context.first_byte_ticks, raw_frame_context.last_byte_ticks);
+	
+	/* Repeated frames of the tag in range only count for the read quality */
+	if (reader->tag_id != 0 && tag_id == reader->tag_id)
+	{
+		reader_presence_frame(reader, true);
+		return;
+	}
+	
+	stats_detection(tag_id);
+	
+	/* Only the first reader has the TAG_IN_RANGE line */
+	if (reader->index != 0)
+		flags &= ~PROTOCOL_IN_RANGE_bm;
+	
+	update_tag_id_arrived(tag_id);
+	
+	/* Check for matching */
+	if (match_is_enabled())
+	{
+		uint16_t out0_period;
+		uint8_t notifications;
+		uint8_t match_index = find_match(tag_id, &out0_period, &notifications);
+		
+		if (match_index != MATCH_NONE)
+			accept_tag_id(reader, flags, tag_id, match_index, out0_period, notifications);
+		else if (app_regs.REG_EVENT_CONFIG & B_UNMATCHED_EN)
+			send_tag_id_unmatched(tag_id);
+	}
+	else
+	{
+		accept_tag_id(reader, flags, tag_id, MATCH_NONE, app_regs.REG_TAG_ID_ARRIVED_PERIOD, app_regs.REG_NOTIFICATIONS);
+	}
+}
+
+void work_do(work_t *item, int8_t flags, uint64_t tag_id)
+{
+	if (item->type == WORK_TAG_ENTERED)
+		process_tag_entered_range();
+	else if (item->type == WORK_TAG_LEFT)
+		process_tag_left_range();
+	else
+	{
+		process_frame(item, flags, tag_id);
+		raw_frame_is_taken = false;
+	}
 }
 
 /************************************************************************/
 /* Buzzer                                                               */
 /************************************************************************/
 extern bool stop_buzzer;
-ISR(TCC0_OVF_vect, ISR_NAKED)
+ISR(TCC0_OVF_vect)
 {
 	set_BUZZER;
-	
-	reti();
 }
 
-ISR(TCC0_CCA_vect, ISR_NAKED)
+ISR(TCC0_CCA_vect)
 {
 	clr_BUZZER;
 	
@@ -279,6 +728,4 @@ ISR(TCC0_CCA_vect, ISR_NAKED)
 		timer_type0_stop(&TCC0);
 		clr_BUZZER;
 	}
-	
-	reti();
 }
\ No newline at end of file
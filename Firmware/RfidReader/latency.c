@@ -0,0 +1,55 @@
+#include <string.h>
+#include "cpu.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "reader.h"
+#include "latency.h"
+
+extern AppRegs app_regs;
+
+
+static uint16_t last_byte_ticks;
+static uint16_t event_ticks;
+static bool out0_is_pending = false;
+
+static void add_sample(uint8_t interval, uint16_t ticks)
+{
+	uint16_t *bucket;
+	uint8_t i = 0;
+	
+	for (ticks /= LATENCY_FIRST_BUCKET_TICKS; ticks && i < LATENCY_BUCKETS - 1; ticks >>= 1)
+		i++;
+	
+	bucket = &app_regs.REG_LATENCY_HISTOGRAM[interval * LATENCY_BUCKETS + i];
+	
+	if (*bucket < 0xFFFF)
+		(*bucket)++;
+}
+
+void latency_reset(void)
+{
+	memset(app_regs.REG_LATENCY_HISTOGRAM, 0, sizeof(app_regs.REG_LATENCY_HISTOGRAM));
+	out0_is_pending = false;
+}
+
+void latency_frame(uint16_t first_byte, uint16_t last_byte)
+{
+	add_sample(LATENCY_FRAME, last_byte - first_byte);
+	last_byte_ticks = last_byte;
+}
+
+void latency_event(bool out0_is_due)
+{
+	event_ticks = reader_read_timer();
+	add_sample(LATENCY_EVENT, event_ticks - last_byte_ticks);
+	out0_is_pending = out0_is_due;
+}
+
+void latency_out0(void)
+{
+	if (out0_is_pending)
+	{
+		out0_is_pending = false;
+		add_sample(LATENCY_OUT0, reader_read_timer() - event_ticks);
+	}
+}
@@ -0,0 +1,40 @@
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Latency histogram                                                    */
+/*                                                                      */
+/* Counts, on fixed buckets, the duration of three intervals:           */
+/*   LATENCY_FRAME: first to last byte (or bit) of a valid frame        */
+/*   LATENCY_EVENT: last byte to the arrival event being sent           */
+/*   LATENCY_OUT0:  arrival event to OUT0 asserted                      */
+/*                                                                      */
+/* Measured on READER_TIMER, 32 us per tick. The first bucket is below  */
+/* 0.5 ms and each of the next ones doubles the limit, so the limits    */
+/* are 0.5, 1, 2, 4, 8, 16 and 32 ms (x 1.024). The last bucket keeps   */
+/* everything above. The counters stop at 0xFFFF.                       */
+/*                                                                      */
+/* The histograms are kept on REG_LATENCY_HISTOGRAM, one after the      */
+/* other, and everything runs at LOW level.                             */
+/************************************************************************/
+#define LATENCY_FRAME               0
+#define LATENCY_EVENT               1
+#define LATENCY_OUT0                2
+
+#define LATENCY_BUCKETS             8
+#define LATENCY_FIRST_BUCKET_TICKS  16    // 0.512 ms
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void latency_reset(void);
+
+void latency_frame(uint16_t first_byte, uint16_t last_byte);
+void latency_event(bool out0_is_due);
+void latency_out0(void);
+
+
+#endif /* _LATENCY_H_ */
@@ -2,6 +2,7 @@
 
 #include "app.h"
 #include "app_ios_and_regs.h"
+#include "work.h"
 
 int main(void)
 {
@@ -11,7 +12,8 @@ int main(void)
 	/* Enable interrupts */
 	hwbp_app_enable_interrupts;
 	
-	/* Infinite loop */
-	while(1);
+	/* Infinite loop, runs the work queued by the interrupts */
+	while(1)
+		work_task();
 		//__asm volatile("sleep");
 }
\ No newline at end of file
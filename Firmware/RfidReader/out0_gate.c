@@ -0,0 +1,174 @@
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "out0_gate.h"
+#include "handler_time.h"
+
+extern AppRegs app_regs;
+
+
+#define OUT0_PIN                    7
+#define ms_to_ticks(ms)             ((uint16_t)(((uint32_t)(ms) * 125) / 4))
+
+static bool is_enabled = false;
+static bool out0_level = false;         // Last level sent on REG_OUT
+static uint16_t holdoff_ms = 0;
+
+#define is_armed                    (OUT0_GATE_TIMER.CTRLD != TC_EVACT_OFF_gc)
+#define arm                         OUT0_GATE_TIMER.CTRLD = TC_EVACT_RESTART_gc | (TC_EVSEL_CH0_gc + OUT0_GATE_EVENT_CHANNEL)
+#define disarm                      OUT0_GATE_TIMER.CTRLD = TC_EVACT_OFF_gc
+
+/* The waveform is inverted on the pin */
+#define pulse_is_active             (!(OUT0_GATE_TIMER.CTRLC & TC0_CMPD_bm))
+
+static uint16_t min_pulse_ticks(void)
+{
+	return ms_to_ticks(app_regs.REG_OUT0_GATE_PULSE);
+}
+
+/************************************************************************/
+/* Enable and disable                                                   */
+/*                                                                      */
+/* OUT0 is pulled down while the pin changes owner, so it never glitches  */
+/************************************************************************/
+void out0_gate_enable(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	
+	PORTD.DIRCLR = (1 << OUT0_PIN);
+	PORTD.PIN7CTRL = PORT_OPC_PULLDOWN_gc | PORT_INVEN_bm;
+	PORTD.OUTSET = (1 << OUT0_PIN);
+	PORTD.DIRSET = (1 << OUT0_PIN);
+	PORTD.REMAP |= PORT_TC0D_bm;
+	
+	(&EVSYS.CH0MUX)[OUT0_GATE_EVENT_CHANNEL] = EVSYS_CHMUX_PORTC_PIN3_gc;
+	
+	/* Start with the waveform set, OUT0 low */
+	OUT0_GATE_TIMER.CTRLA = TC_CLKSEL_OFF_gc;
+	OUT0_GATE_TIMER.CTRLC = TC0_CMPD_bm;
+	OUT0_GATE_TIMER.CTRLB = TC0_CCDEN_bm | TC_WGMODE_SS_gc;
+	OUT0_GATE_TIMER.CNT = 0;
+	OUT0_GATE_TIMER.PER = (app_regs.REG_OUT0_GATE & B_OUT0_GATE_FOLLOW) ? 0xFFFE : min_pulse_ticks();
+	OUT0_GATE_TIMER.CCD = 0xFFFF;
+	OUT0_GATE_TIMER.CTRLA = TC_CLKSEL_DIV1024_gc;
+	
+	is_enabled = true;
+	out0_level = false;
+	holdoff_ms = 0;
+	
+	if (!read_TAG_IN_RANGE)
+		arm;
+	
+	SREG = sreg;
+}
+
+void out0_gate_disable(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	
+	is_enabled = false;
+	
+	disarm;
+	OUT0_GATE_TIMER.CTRLA = TC_CLKSEL_OFF_gc;
+	OUT0_GATE_TIMER.CTRLB = 0;
+	
+	PORTD.DIRCLR = (1 << OUT0_PIN);
+	PORTD.PIN7CTRL = PORT_OPC_PULLDOWN_gc;
+	PORTD.REMAP &= ~PORT_TC0D_bm;
+	PORTD.OUTCLR = (1 << OUT0_PIN);
+	PORTD.DIRSET = (1 << OUT0_PIN);
+	PORTD.PIN7CTRL = PORT_OPC_TOTEM_gc;
+	
+	/* The timer measures the handlers again */
+	handler_time_start_timer();
+	
+	SREG = sreg;
+}
+
+bool out0_gate_is_enabled(void)
+{
+	return is_enabled;
+}
+
+/************************************************************************/
+/* TAG_IN_RANGE edges                                                   */
+/************************************************************************/
+void out0_gate_edge(bool rising)
+{
+	uint16_t end;
+	
+	if (!is_enabled)
+		return;
+	
+	if (rising)
+	{
+		/* The event system already started the pulse */
+		disarm;
+	}
+	else if ((app_regs.REG_OUT0_GATE & B_OUT0_GATE_FOLLOW) && pulse_is_active)
+	{
+		/* End on the next tick, or after the minimum pulse */
+		end = OUT0_GATE_TIMER.CNT + 1;
+		
+		if (end < min_pulse_ticks())
+			end = min_pulse_ticks();
+		
+		OUT0_GATE_TIMER.PER = end;
+	}
+}
+
+/************************************************************************/
+/* Publish OUT0 and arm the gate again                                  */
+/************************************************************************/
+void out0_gate_tick_1ms(void)
+{
+	uint8_t sreg;
+	
+	if (!is_enabled)
+		return;
+	
+	if (pulse_is_active != out0_level)
+	{
+		out0_level = pulse_is_active;
+		
+		if (out0_level)
+		{
+			if (core_bool_is_visual_enabled())
+				set_LED_OUT0;
+		}
+		else
+		{
+			clr_LED_OUT0;
+			holdoff_ms = app_regs.REG_OUT0_GATE_HOLDOFF;
+		}
+		
+		app_regs.REG_OUT = out0_level ? B_OUT0 : 0;
+		core_func_send_event(ADD_REG_OUT, true);
+	}
+	
+	if (out0_level || is_armed)
+		return;
+	
+	if (holdoff_ms)
+	{
+		holdoff_ms--;
+		return;
+	}
+	
+	/* Only a rising edge can start the next pulse */
+	sreg = SREG;
+	cli();
+	
+	if (!read_TAG_IN_RANGE)
+	{
+		OUT0_GATE_TIMER.PER = (app_regs.REG_OUT0_GATE & B_OUT0_GATE_FOLLOW) ? 0xFFFE : min_pulse_ticks();
+		arm;
+	}
+	
+	SREG = sreg;
+}
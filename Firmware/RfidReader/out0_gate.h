@@ -0,0 +1,45 @@
+#ifndef _OUT0_GATE_H_
+#define _OUT0_GATE_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* OUT0 gated by TAG_IN_RANGE                                           */
+/*                                                                      */
+/* TAG_IN_RANGE (PC3) is routed through the event system to restart     */
+/* OUT0_GATE_TIMER, whose channel D drives OUT0 (PD7, remapped).        */
+/* A restart clears the waveform and the pin is inverted, so OUT0 rises */
+/* on the edge itself, without the CPU. The waveform is set again when  */
+/* the timer wraps, ending the pulse, and stays set since the compare   */
+/* value is above the period.                                           */
+/*                                                                      */
+/* The rising edge interrupt (HIGH level) disarms the restart, so the   */
+/* falling edge and the chatter don't restart the pulse. The 1 ms tick  */
+/* arms it again after the pulse and the hold-off, once the tag left.   */
+/* With B_OUT0_GATE_FOLLOW the pulse lasts until the falling edge, but  */
+/* never less than the minimum pulse. Pulses last up to ~2 s.           */
+/*                                                                      */
+/* While enabled, OUT0 belongs to the gate and REG_OUT is only written  */
+/* by the 1 ms tick, which sends its events.                            */
+/************************************************************************/
+#define OUT0_GATE_TIMER             TCD0
+#define OUT0_GATE_EVENT_CHANNEL     0
+
+#define OUT0_GATE_MAX_PULSE         2000        // ms, 32 us per tick
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void out0_gate_enable(void);
+void out0_gate_disable(void);
+bool out0_gate_is_enabled(void);
+
+/* Called from the TAG_IN_RANGE interrupt (HIGH level) */
+void out0_gate_edge(bool rising);
+
+/* Called every millisecond (LOW level) */
+void out0_gate_tick_1ms(void);
+
+
+#endif /* _OUT0_GATE_H_ */
@@ -0,0 +1,374 @@
+#include <string.h>
+#include <avr/pgmspace.h>
+#include "cpu.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "reader.h"
+#include "handler_time.h"
+
+extern AppRegs app_regs;
+extern void capture_timestamp(volatile timestamp_t *timestamp);
+
+
+/************************************************************************/
+/* Readers                                                              */
+/************************************************************************/
+reader_t readers[READER_COUNT] = {
+	{.uart = &USARTD0, .index = 0},     // Driven by uart0.c
+#if READER_COUNT > 1
+	{.uart = &USARTC1, .index = 1},
+#endif
+};
+
+void reader_init(void)
+{
+	/* Free running, the compare channels give the frame timeouts */
+	timer_type1_enable(&READER_TIMER, TIMER_PRESCALER_DIV1024, 0xFFFF, INT_LEVEL_OFF);
+	
+#if READER_COUNT > 1
+	/* Second reader on USARTC1, receive only */
+	io_pin2in(&PORTC, 6, PULL_IO_TRISTATE, SENSE_IO_NO_INT_USED);
+	USARTC1.CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_CHSIZE_8BIT_gc;
+	USARTC1.CTRLB |= USART_RXEN_bm;
+	USARTC1.CTRLA |= (READER_RX_INT_LEVEL << 4);
+#endif
+	
+	reader_set_baud_rate(GM_BAUD_9600);
+}
+
+/************************************************************************/
+/* Baud rate                                                            */
+/*                                                                      */
+/* BSEL and BSCALE for the 32 MHz clock, all within 0.01% of the baud   */
+/* rate, and the frame timeout of each rate, ~4.8 bytes (10 bits each). */
+/************************************************************************/
+typedef struct
+{
+	uint16_t bsel;
+	int8_t bscale;
+	uint8_t timeout;
+} baud_rate_t;
+
+static const baud_rate_t baud_rates[] PROGMEM = {
+	[GM_BAUD_9600]   = {.bsel = 3317, .bscale = -4, .timeout = 156},
+	[GM_BAUD_19200]  = {.bsel = 3301, .bscale = -5, .timeout = 78},
+	[GM_BAUD_38400]  = {.bsel = 3269, .bscale = -6, .timeout = 39},
+	[GM_BAUD_57600]  = {.bsel = 2158, .bscale = -6, .timeout = 26},
+	[GM_BAUD_115200] = {.bsel = 2094, .bscale = -7, .timeout = 13}
+};
+
+/* The first reader's module may use Wiegand instead of its UART */
+static bool uses_wiegand(reader_t *reader)
+{
+	return reader->index == 0 && app_regs.REG_READER_INTERFACE == GM_READER_WIEGAND;
+}
+
+/* All the readers, the frame being received is lost */
+void reader_set_baud_rate(uint8_t baud_rate)
+{
+	baud_rate_t b;
+	
+	memcpy_P(&b, &baud_rates[baud_rate], sizeof(baud_rate_t));
+	
+	for (uint8_t i = 0; i < READER_COUNT; i++)
+	{
+		/* Writing BAUDCTRLA updates the baud rate */
+		readers[i].uart->BAUDCTRLB = (uint8_t)(b.bscale << 4) | (b.bsel >> 8);
+		readers[i].uart->BAUDCTRLA = (uint8_t)b.bsel;
+		readers[i].max_timeout = uses_wiegand(&readers[i]) ? READER_WIEGAND_TIMEOUT : b.timeout;
+	}
+	
+	reader_reset_timeouts();
+}
+
+/************************************************************************/
+/* Adaptive frame timeout                                               */
+/************************************************************************/
+void reader_reset_timeouts(void)
+{
+	uint8_t sreg = SREG;
+	
+	/* The RX interrupts (MED level) learn */
+	cli();
+	
+	for (uint8_t i = 0; i < READER_COUNT; i++)
+	{
+		readers[i].timeout = readers[i].max_timeout;
+		readers[i].timeout_bytes = READER_TIMEOUT_BYTES;
+		readers[i].learned_gaps = 0;
+		readers[i].timeout_backoffs = 0;
+	}
+	
+	SREG = sreg;
+}
+
+static void learn_byte_time(reader_t *reader, uint16_t ticks)
+{
+	uint16_t gap = ticks - reader->last_byte_ticks;
+	uint16_t timeout;
+	
+	/* Only within the frames */
+	if (reader->rx_length == 0)
+		return;
+	
+	if (reader->learned_gaps == 0)
+		reader->byte_time = gap << 4;
+	else
+		reader->byte_time += ((int16_t)(gap << 4) - (int16_t)reader->byte_time) / 8;
+	
+	if (reader->learned_gaps < READER_LEARN_GAPS)
+	{
+		reader->learned_gaps++;
+		return;
+	}
+	
+	timeout = ((reader->byte_time * reader->timeout_bytes) >> 4) + 2;
+	reader->timeout = (timeout < reader->max_timeout) ? timeout : reader->max_timeout;
+}
+
+/* Called with the LOW level masked, the frame may have been cut short */
+void reader_frame_error(reader_t *reader)
+{
+	uint8_t sreg = SREG;
+	
+	if (reader->timeout == reader->max_timeout)
+		return;
+	
+	cli();
+	
+	if (reader->timeout_bytes < READER_TIMEOUT_MAX_BYTES)
+		reader->timeout_bytes++;
+	
+	if (reader->timeout_backoffs < 0xFFFF)
+		reader->timeout_backoffs++;
+	
+	SREG = sreg;
+}
+
+#if READER_COUNT > 1
+ISR(USARTC1_RXC_vect)
+{
+	uint16_t start = handler_time_start();
+	
+	reader_rcv_byte(&readers[1], USARTC1.DATA);
+	handler_time_stop(HANDLER_MED, start);
+}
+#endif
+
+/************************************************************************/
+/* Frame timeout                                                        */
+/************************************************************************/
+static void start_timeout(reader_t *reader, uint16_t ticks)
+{
+	(&READER_TIMER.CCA)[reader->index] = ticks + reader->timeout;
+	READER_TIMER.INTFLAGS = (TC1_CCAIF_bm << reader->index);
+	READER_TIMER.INTCTRLB |= (FRAME_TIMEOUT_INT_LEVEL << (reader->index * 2));
+}
+
+static void restart_timeout(reader_t *reader)
+{
+	uint16_t ticks = READER_TIMER.CNT;
+	
+	reader->last_byte_ticks = ticks;
+	start_timeout(reader, ticks);
+}
+
+void reader_stop_timeout(reader_t *reader)
+{
+	READER_TIMER.INTCTRLB &= ~(TC1_CCAINTLVL_gm << (reader->index * 2));
+}
+
+/************************************************************************/
+/* Receive                                                              */
+/************************************************************************/
+/* The held frame and its context stay untouched */
+static bool drops_frame(reader_t *reader)
+{
+	if (!reader->frame_is_held && !reader->frame_is_dropped)
+		return false;
+	
+	reader->frame_is_dropped = true;
+	start_timeout(reader, READER_TIMER.CNT);
+	
+	return true;
+}
+
+static void start_frame(reader_t *reader)
+{
+	reader->first_byte_ticks = READER_TIMER.CNT;
+}
+
+void reader_rcv_byte(reader_t *reader, uint8_t byte)
+{
+	if (drops_frame(reader))
+		return;
+	
+	learn_byte_time(reader, READER_TIMER.CNT);
+	
+	if (reader->rx_length == 0)
+	{
+		start_frame(reader);
+		
+		if (app_regs.REG_RAW_FRAME_CONFIG)
+			capture_timestamp(&reader->frame_timestamp);
+	}
+	
+	if (reader->rx_length < READER_RXBUFSIZ)
+		reader->rxbuff[reader->rx_length] = byte;
+	
+	if (reader->rx_length < 0xFF)
+		reader->rx_length++;
+	
+	restart_timeout(reader);
+}
+
+void reader_rcv_bit(reader_t *reader, bool bit)
+{
+	uint8_t mask = 0x80 >> (reader->rx_length & 7);
+	
+	if (drops_frame(reader))
+		return;
+	
+	if (reader->rx_length == 0)
+		start_frame(reader);
+	
+	if (reader->rx_length < READER_RXBUFSIZ * 8)
+	{
+		if (bit)
+			reader->rxbuff[reader->rx_length >> 3] |= mask;
+		else
+			reader->rxbuff[reader->rx_length >> 3] &= ~mask;
+	}
+	
+	if (reader->rx_length < 0xFF)
+		reader->rx_length++;
+	
+	restart_timeout(reader);
+}
+
+/************************************************************************/
+/* Take the frame                                                       */
+/************************************************************************/
+/* Clears it, the frame was received while the buffer was held */
+bool reader_frame_was_dropped(reader_t *reader)
+{
+	if (!reader->frame_is_dropped)
+		return false;
+	
+	reader->frame_is_dropped = false;
+	
+	return true;
+}
+
+/* Until reader_take_frame(), the next frame is dropped */
+void reader_hold_frame(reader_t *reader)
+{
+	reader->frame_is_held = true;
+}
+
+/* The RX interrupts (MED level) may start the next frame meanwhile */
+void reader_discard_frame(reader_t *reader)
+{
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	
+	PMIC.CTRL = pmic_ctrl & ~PMIC_MEDLVLEN_bm;
+	reader->rx_length = 0;
+	PMIC.CTRL = pmic_ctrl;
+}
+
+/* Take the frame and release the buffer to the RX interrupts (MED level) */
+uint8_t reader_take_frame(reader_t *reader, uint8_t *frame, reader_frame_t *context)
+{
+	uint8_t length;
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	
+	PMIC.CTRL = pmic_ctrl & ~PMIC_MEDLVLEN_bm;
+	length = reader->rx_length;
+	memcpy(frame, reader->rxbuff, (length < READER_RXBUFSIZ) ? length : READER_RXBUFSIZ);
+	context->timestamp.second = reader->frame_timestamp.second;
+	context->timestamp.usecond = reader->frame_timestamp.usecond;
+	context->first_byte_ticks = reader->first_byte_ticks;
+	context->last_byte_ticks = reader->last_byte_ticks;
+	reader->rx_length = 0;
+	reader->frame_is_held = false;
+	PMIC.CTRL = pmic_ctrl;
+	
+	return length;
+}
+
+/* The RX interrupts (MED level) also use the timer's TEMP register */
+uint16_t reader_read_timer(void)
+{
+	uint16_t ticks;
+	uint8_t sreg = SREG;
+	
+	cli();
+	ticks = READER_TIMER.CNT;
+	SREG = sreg;
+	
+	return ticks;
+}
+
+/************************************************************************/
+/* Read quality                                                         */
+/*                                                                      */
+/* Counts the frames received while a tag is in range, from the arrival */
+/* to the leave event. Reported as: valid frames, frame errors, mean    */
+/* and minimum interval between valid frames (ms).                      */
+/************************************************************************/
+static uint16_t reader_ms = 0;
+
+void reader_tick_1ms(void)
+{
+	reader_ms++;
+}
+
+void reader_presence_start(reader_t *reader)
+{
+	reader->presence_frames = 1;
+	reader->presence_errors = 0;
+	reader->presence_min_interval = 0xFFFF;
+	reader->presence_interval_sum = 0;
+	reader->presence_last_frame = reader_ms;
+}
+
+void reader_presence_frame(reader_t *reader, bool valid)
+{
+	uint16_t interval;
+	
+	if (!valid)
+	{
+		if (reader->presence_errors < 0xFFFF)
+			reader->presence_errors++;
+		return;
+	}
+	
+	interval = reader_ms - reader->presence_last_frame;
+	reader->presence_last_frame = reader_ms;
+	
+	if (reader->presence_frames < 0xFFFF)
+		reader->presence_frames++;
+	
+	reader->presence_interval_sum += interval;
+	
+	if (interval < reader->presence_min_interval)
+		reader->presence_min_interval = interval;
+}
+
+void reader_presence_report(reader_t *reader, uint16_t *quality)
+{
+	quality[0] = reader->presence_frames;
+	quality[1] = reader->presence_errors;
+	
+	if (reader->presence_frames > 1)
+	{
+		quality[2] = reader->presence_interval_sum / (reader->presence_frames - 1);
+		quality[3] = reader->presence_min_interval;
+	}
+	else
+	{
+		quality[2] = 0;
+		quality[3] = 0;
+	}
+}
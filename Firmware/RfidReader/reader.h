@@ -0,0 +1,117 @@
+#ifndef _READER_H_
+#define _READER_H_
+#include "cpu.h"
+#include "hwbp_core.h"
+
+
+/************************************************************************/
+/* Reader modules                                                       */
+/*                                                                      */
+/* Each reader module has its own context, with the frame being         */
+/* received and the state of the tag in range, so several modules can   */
+/* be served by the same board, each on its own USART.                  */
+/*                                                                      */
+/* A frame whose work is queued behind another frame is held on the     */
+/* reader's buffer until the main loop takes it (see work.h). The frame */
+/* received meanwhile is dropped, up to its own frame timeout, so the   */
+/* reader always starts again on a frame's first byte.                  */
+/*                                                                      */
+/* The frame timeouts share READER_TIMER, which runs freely. Each       */
+/* reader uses the compare channel of its index, so up to 2 readers.    */
+/* Only the first reader has the TAG_IN_RANGE line.                     */
+/*                                                                      */
+/* Wiegand's frame timeout is fixed, its bits are 1 to 2 ms apart. The  */
+/* UART's starts at the baud rate's (~4.8 bytes) and learns             */
+/* from the gaps between the bytes of each frame: timeout_bytes times   */
+/* their average, plus 2 ticks for the resolution, never longer than    */
+/* the baud rate's. Each frame error with a shortened timeout adds a    */
+/* byte to timeout_bytes, in case the module pauses within its frames.  */
+/************************************************************************/
+#define READER_COUNT            1
+#define READER_RXBUFSIZ         30                // Bytes kept on REG_RAW_FRAME, the longest frame decoded, or bits * 8
+
+#define READER_RX_INT_LEVEL     INT_LEVEL_MED     // Check the priorities on app.h
+
+#define READER_TIMER            TCD1              // 32 us per tick
+
+#define READER_WIEGAND_TIMEOUT  156               // ~5 ms
+
+#define READER_TIMEOUT_BYTES    3                 // Learned timeout, from there up to READER_TIMEOUT_MAX_BYTES
+#define READER_TIMEOUT_MAX_BYTES 8
+#define READER_LEARN_GAPS       16                // Before the timeout is shortened
+
+/* Of a frame taken from the reader's buffer */
+typedef struct
+{
+	timestamp_t timestamp;              // Of the first byte, for the raw frames
+	uint16_t first_byte_ticks;          // READER_TIMER
+	uint16_t last_byte_ticks;
+} reader_frame_t;
+
+typedef struct
+{
+	USART_t *uart;
+	uint8_t index;                      // Antenna, also the compare channel on READER_TIMER
+	volatile uint8_t timeout;           // Frame timeout in use, READER_TIMER ticks
+	uint8_t max_timeout;                // Baud rate's (~4.8 bytes) or Wiegand's
+	uint8_t timeout_bytes;
+	uint8_t learned_gaps;
+	uint16_t byte_time;                 // Average gap between the bytes of a frame, 1/16 of a tick
+	uint16_t timeout_backoffs;          // Frame errors with a shortened timeout
+	uint8_t rxbuff[READER_RXBUFSIZ];    // Bytes, or Wiegand's bits MSB first
+	volatile uint8_t rx_length;         // Bytes (or bits) received, stops at 255
+	volatile timestamp_t frame_timestamp;
+	volatile uint16_t first_byte_ticks; // READER_TIMER at the first byte of the frame
+	volatile uint16_t last_byte_ticks;  // READER_TIMER at the last byte received
+	volatile bool frame_is_held;        // The buffer holds a queued frame
+	volatile bool frame_is_dropped;     // Received while held, until its frame timeout
+	bool id_event_was_sent;             // Set by the arrival, cleared when the tag leaves the range
+	uint64_t tag_id;                    // Tag in range, waiting for the leave event
+	uint8_t match_index;                // Matching ID of that tag, MATCH_NONE if none
+	bool events_are_suppressed;         // By a rule, for that tag
+	
+	/* Read quality while the tag is in range */
+	uint16_t presence_frames;
+	uint16_t presence_errors;
+	uint16_t presence_min_interval;     // ms
+	uint32_t presence_interval_sum;     // ms
+	uint16_t presence_last_frame;       // reader_ms of the last valid frame
+} reader_t;
+
+extern reader_t readers[READER_COUNT];
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void reader_init(void);
+void reader_set_baud_rate(uint8_t baud_rate);
+
+/* Back to the interface's timeout, learned again */
+void reader_reset_timeouts(void);
+void reader_frame_error(reader_t *reader);
+
+/* Called from the RX interrupts */
+void reader_rcv_byte(reader_t *reader, uint8_t byte);
+void reader_rcv_bit(reader_t *reader, bool bit);
+
+/* Called from the frame timeout */
+void reader_stop_timeout(reader_t *reader);
+bool reader_frame_was_dropped(reader_t *reader);
+void reader_hold_frame(reader_t *reader);
+void reader_discard_frame(reader_t *reader);
+
+/* Called from the frame timeout, or the main loop with the LOW level masked if it was held */
+uint8_t reader_take_frame(reader_t *reader, uint8_t *frame, reader_frame_t *context);
+
+/* READER_TIMER, from LOW level or the main loop */
+uint16_t reader_read_timer(void);
+
+/* Read quality, all at LOW level */
+void reader_tick_1ms(void);
+void reader_presence_start(reader_t *reader);
+void reader_presence_frame(reader_t *reader, bool valid);
+void reader_presence_report(reader_t *reader, uint16_t *quality);
+
+
+#endif /* _READER_H_ */
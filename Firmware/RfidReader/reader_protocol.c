@@ -0,0 +1,124 @@
+#include <avr/pgmspace.h>
+#include "reader_protocol.h"
+
+
+/************************************************************************/
+/* Protocols' table                                                     */
+/************************************************************************/
+static const reader_protocol_t protocols[PROTOCOL_COUNT] PROGMEM = {
+	
+	/* 125 kHz nominal carrier (EM 4001 or compatible)
+	   STX, 10 ASCII ID (5 bytes), 2 ASCII checksum (1 byte), CR, LF, ETX */
+	[PROTOCOL_EM4100] = {
+		.frame_length = 16,
+		.header = 0x02,
+		.trailer = {0x0D, 0x0A, 0x03},
+		.id_length = 5,
+		.checksum = CHECKSUM_XOR,
+		.byte_order = ID_MSB_FIRST,
+		.id_format = ID_RAW,
+		.flags = PROTOCOL_IN_RANGE_bm
+	},
+	
+	/* ISO11785
+	   STX, 16 ASCII ID (8 bytes), 4 ASCII checksum (2 bytes),
+	   6 ASCII extension bits (3 bytes), CR, LF, ETX
+	   Checksum confirmation for ISO11785 not implemented yet */
+	[PROTOCOL_FDX_B] = {
+		.frame_length = 30,
+		.header = 0x02,
+		.trailer = {0x0D, 0x0A, 0x03},
+		.id_length = 8,
+		.checksum = CHECKSUM_NONE,
+		.byte_order = ID_LSB_FIRST_REVERSED,
+		.id_format = ID_ISO11784,
+		.flags = 0
+	}
+};
+
+uint8_t reverse_byte(uint8_t num)
+{
+    uint8_t NO_OF_BITS = 8;
+    uint8_t reverse_num = 0;
+    uint8_t i;
+	 
+    for (i = 0; i < NO_OF_BITS; i++)
+	 {
+        if ((num & (1 << i)))
+		  {
+            reverse_num |= 1 << ((NO_OF_BITS - 1) - i);
+		  }
+    }
+    return reverse_num;
+}
+
+/************************************************************************/
+/* Parser                                                               */
+/************************************************************************/
+static uint8_t hex_digit(uint8_t digit)
+{
+	return (digit <= '9') ? digit - '0' : digit - 'A' + 10;
+}
+
+/* Byte i of the digits, after the header */
+static uint8_t frame_byte(const uint8_t *frame, uint8_t i)
+{
+	return (hex_digit(frame[i*2+1]) << 4) + hex_digit(frame[i*2+2]);
+}
+
+int8_t reader_protocol_decode(const uint8_t *frame, uint8_t frame_length, uint8_t enabled_mask, uint64_t *tag_id)
+{
+	reader_protocol_t p;
+	uint8_t i;
+	
+	/* Find the protocol */
+	for (i = 0; i < PROTOCOL_COUNT; i++)
+	{
+		if ((enabled_mask & (1 << i)) && pgm_read_byte(&protocols[i].frame_length) == frame_length)
+			break;
+	}
+	
+	if (i == PROTOCOL_COUNT)
+		return -1;
+	
+	memcpy_P(&p, &protocols[i], sizeof(reader_protocol_t));
+	
+	/* Check message start and termination */
+	if (frame[0] != p.header) return -1;
+	if (frame[frame_length - 3] != p.trailer[0]) return -1;
+	if (frame[frame_length - 2] != p.trailer[1]) return -1;
+	if (frame[frame_length - 1] != p.trailer[2]) return -1;
+	
+	/* Confirm checksum */
+	if (p.checksum == CHECKSUM_XOR)
+	{
+		uint8_t checksum = 0;
+		
+		for (i = 0; i < p.id_length; i++)
+			checksum ^= frame_byte(frame, i);
+		
+		if (checksum != frame_byte(frame, p.id_length))
+			return -1;
+	}
+	
+	/* Convert tag ID to the 64 bits register */
+	*tag_id = 0;
+	
+	for (i = 0; i < p.id_length; i++)
+	{
+		if (p.byte_order == ID_MSB_FIRST)
+			*(((uint8_t*)(tag_id)) + p.id_length - 1 - i) = frame_byte(frame, i);
+		else
+			*(((uint8_t*)(tag_id)) + i) = reverse_byte(frame_byte(frame, i));
+	}
+	
+	if (p.id_format == ID_ISO11784)
+	{
+		uint64_t id           = (*tag_id & 0x3FFFFFFFFF);
+		uint64_t country_code = (*tag_id & 0xFFC000000000) >> 38;
+		
+		*tag_id = country_code * 1000000000000 + id;
+	}
+	
+	return p.flags;
+}
@@ -0,0 +1,65 @@
+#ifndef _READER_PROTOCOL_H_
+#define _READER_PROTOCOL_H_
+#include <avr/io.h>
+
+
+/************************************************************************/
+/* Reader protocols                                                     */
+/*                                                                      */
+/* Each ASCII framed format the reader module can send is described by  */
+/* a line on the protocols' table (reader_protocol.c) and decoded by    */
+/* the same parser. A new format is a new line, not new code.           */
+/*                                                                      */
+/* Frame: header, ASCII hex digits, trailer                             */
+/* The digits are converted to bytes, the first id_length bytes are the */
+/* ID and the checksum, if any, follows the ID.                         */
+/*                                                                      */
+/* The parser doesn't touch the registers, so it can be built and       */
+/* benchmarked on its own.                                              */
+/************************************************************************/
+#define PROTOCOL_EM4100             0
+#define PROTOCOL_FDX_B              1
+#define PROTOCOL_COUNT              2
+
+#define PROTOCOL_MAX_FRAME_LENGTH   30
+
+/* Checksum */
+#define CHECKSUM_NONE               0
+#define CHECKSUM_XOR                1       // XOR of the ID's bytes, on the byte after the ID
+
+/* ID's byte order */
+#define ID_MSB_FIRST                0
+#define ID_LSB_FIRST_REVERSED       1       // LSB first, with the bits of each byte reversed
+
+/* ID's format */
+#define ID_RAW                      0
+#define ID_ISO11784                 1       // 38 bits national code and 10 bits country code
+
+/* Flags */
+#define PROTOCOL_IN_RANGE_bm        (1<<0)  // The module drives TAG_IN_RANGE while the tag is present
+
+typedef struct
+{
+	uint8_t frame_length;
+	uint8_t header;
+	uint8_t trailer[3];
+	uint8_t id_length;
+	uint8_t checksum;
+	uint8_t byte_order;
+	uint8_t id_format;
+	uint8_t flags;
+} reader_protocol_t;
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+/* Decode the frame with the first enabled protocol of the same length */
+/* Returns the protocol's flags, or -1 if the frame was not decoded.   */
+/* The frame is left untouched.                                        */
+int8_t reader_protocol_decode(const uint8_t *frame, uint8_t frame_length, uint8_t enabled_mask, uint64_t *tag_id);
+
+uint8_t reverse_byte(uint8_t num);
+
+
+#endif /* _READER_PROTOCOL_H_ */
@@ -0,0 +1,89 @@
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "rules.h"
+
+extern AppRegs app_regs;
+
+
+/* See VISIT_AGE_SECONDS */
+static uint8_t visit_age[MATCH_TABLE_FIRST_INDEX + MATCH_TABLE_SIZE];
+
+static bool is_absent(uint8_t match_index, uint16_t min_absence)
+{
+	uint8_t age = visit_age[match_index];
+	
+	if (age == 0 || age == VISIT_AGE_MAX)
+		return true;
+	
+	if (age <= VISIT_AGE_SECONDS + 1)
+		return age - 1 >= min_absence;
+	
+	/* The minutes advance with the Harp time's, so the first one may be shorter */
+	return (uint16_t)(age - VISIT_AGE_SECONDS) * 60 >= min_absence;
+}
+
+static bool rule_is_met(rule_t *rule, uint8_t match_index, uint32_t second)
+{
+	uint8_t conditions = rule->flags;
+	uint8_t index_bit = (match_index == MATCH_NONE) ? RULE_NO_MATCH : (1 << match_index);
+	
+	if ((conditions & RULE_MATCH_INDEX_bm) && !(rule->match_indexes & index_bit))
+		return false;
+	
+	if ((conditions & RULE_ABSENCE_bm) && match_index != MATCH_NONE)
+		if (!is_absent(match_index, rule->min_absence))
+			return false;
+	
+	if ((conditions & RULE_IN_RANGE_bm) && !read_TAG_IN_RANGE)
+		return false;
+	
+	if ((conditions & RULE_NOT_IN_RANGE_bm) && read_TAG_IN_RANGE)
+		return false;
+	
+	/* Also false before the window starts */
+	if ((conditions & RULE_WINDOW_bm) && second - rule->window_start >= rule->window_length)
+		return false;
+	
+	return true;
+}
+
+uint8_t rules_apply(uint8_t match_index, uint32_t second, uint16_t *out0_period, uint8_t *notifications)
+{
+	rule_t *rules = (rule_t*)app_regs.REG_RULES;
+	uint8_t actions = 0;
+	
+	for (uint8_t i = 0; i < RULES_SIZE; i++)
+	{
+		if ((rules[i].flags & RULE_ACTIONS_gm) && rule_is_met(&rules[i], match_index, second))
+		{
+			actions = rules[i].flags & RULE_ACTIONS_gm;
+			
+			if (actions & RULE_OUT0_bm)
+				*out0_period = rules[i].out0_period;
+			
+			if (actions & RULE_NOTIFY_bm)
+				*notifications = rules[i].notifications;
+			
+			break;
+		}
+	}
+	
+	/* Every detection is a visit, even if suppressed */
+	if (match_index != MATCH_NONE)
+		visit_age[match_index] = 1;
+	
+	return actions;
+}
+
+void rules_new_second(void)
+{
+	bool new_minute = (core_func_read_R_TIMESTAMP_SECOND() % 60) == 0;
+	
+	for (uint8_t i = 0; i < MATCH_TABLE_FIRST_INDEX + MATCH_TABLE_SIZE; i++)
+		if (visit_age[i] && visit_age[i] < VISIT_AGE_MAX)
+			if (visit_age[i] <= VISIT_AGE_SECONDS || new_minute)
+				visit_age[i]++;
+}
@@ -0,0 +1,67 @@
+#ifndef _RULES_H_
+#define _RULES_H_
+#include "cpu.h"
+#include "app.h"
+
+
+/************************************************************************/
+/* Rules                                                                */
+/*                                                                      */
+/* Checked in order on each accepted detection. The first rule with all */
+/* its conditions met applies its actions, replacing the OUT0 period    */
+/* and the notifications of the matching ID, or suppressing the events. */
+/* A rule without actions is unused, one without conditions always met. */
+/*                                                                      */
+/* The rules are kept on REG_RULES and everything runs at LOW level.    */
+/* Interface/rules_model.py runs the same rules on the host.            */
+/************************************************************************/
+#define RULES_SIZE                  3
+
+typedef struct
+{
+	uint8_t flags;              // Conditions on bits 0 to 4, actions on bits 5 to 7
+	uint8_t match_indexes;      // Bit n is the match index n, RULE_NO_MATCH for tags without one
+	uint16_t min_absence;       // s since the last detection of the same match index
+	uint32_t window_start;      // Harp seconds
+	uint16_t window_length;     // s
+	uint16_t out0_period;       // ms
+	uint8_t notifications;
+} rule_t;
+
+/* Conditions */
+#define RULE_MATCH_INDEX_bm         (1<<0)      // The match index is on match_indexes
+#define RULE_ABSENCE_bm             (1<<1)      // Not detected for min_absence, always met without a match index
+#define RULE_IN_RANGE_bm            (1<<2)      // TAG_IN_RANGE is high
+#define RULE_NOT_IN_RANGE_bm        (1<<3)      // TAG_IN_RANGE is low
+#define RULE_WINDOW_bm              (1<<4)      // Harp time within window_start and window_start + window_length
+
+#define RULE_NO_MATCH               (1<<7)
+
+#if MATCH_TABLE_FIRST_INDEX + MATCH_TABLE_SIZE > 7
+	#error "The match indexes don't fit on match_indexes"
+#endif
+
+/* Actions */
+#define RULE_OUT0_bm                (1<<5)      // Pulse OUT0 for out0_period, 0 to skip the pulse
+#define RULE_NOTIFY_bm              (1<<6)      // Use the notifications mask
+#define RULE_SUPPRESS_bm            (1<<7)      // No arrival and leave events
+#define RULE_ACTIONS_gm             (RULE_OUT0_bm | RULE_NOTIFY_bm | RULE_SUPPRESS_bm)
+
+/* Age of the last detection of each match index, on a byte: 0 if never */
+/* detected, then seconds plus one up to 2 minutes and minutes up to    */
+/* 2 h 15 min. The minimum absence is exact up to 2 minutes, rounded up */
+/* to the minute after that, and always met after 2 h 15 min.           */
+#define VISIT_AGE_SECONDS           120
+#define VISIT_AGE_MAX               255
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+/* Returns the actions applied, 0 if no rule was met, second is the detection's Harp second */
+uint8_t rules_apply(uint8_t match_index, uint32_t second, uint16_t *out0_period, uint8_t *notifications);
+
+void rules_new_second(void);
+
+
+#endif /* _RULES_H_ */
@@ -0,0 +1,258 @@
+#include <avr/pgmspace.h>
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "uart0.h"
+#include "reader.h"
+#include "reader_protocol.h"
+#include "self_test.h"
+
+extern AppRegs app_regs;
+
+
+/************************************************************************/
+/* Synthetic frames                                                     */
+/************************************************************************/
+static const uint8_t em4100_frame[] PROGMEM = {
+	0x02, '0','A','1','B','2','C','3','D','4','E', '4','E', 0x0D, 0x0A, 0x03
+};
+
+static const uint8_t fdx_b_frame[] PROGMEM = {
+	0x02, '0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F',
+	'0','0','0','0', '0','0','0','0','0','0', 0x0D, 0x0A, 0x03
+};
+
+#define EM4100_TAG_ID               0x0A1B2C3D4EULL
+#define FDX_B_TAG_ID                854076883870848ULL      // Country 854, national code 76883870848
+
+/************************************************************************/
+/* State                                                                */
+/************************************************************************/
+#define STEP_INJECTING              0
+#define STEP_STOPPING               1       // Waiting for the frame being sent
+#define STEP_DRAINING               2
+
+static volatile bool is_running = false;
+static uint8_t frames_mask;
+static uint8_t rx_int_level;                // Of the module's RX, restored at the end
+static uint8_t step;
+static uint16_t step_ms;
+
+/* Injection, at MED level */
+static volatile bool stop_request;
+static volatile bool is_stopped;
+static volatile uint8_t byte_period;        // READER_TIMER ticks
+static uint8_t protocol;
+static uint8_t byte_index;
+static uint16_t frames_sent;                // Read once stopped
+
+/* Counted with the LOW level masked or at LOW level */
+static uint16_t frames_valid;
+static uint16_t overruns;
+static uint16_t last_tick;
+
+#define frame_length(protocol)      ((protocol) == PROTOCOL_EM4100 ? sizeof(em4100_frame) : sizeof(fdx_b_frame))
+#define frame_byte(protocol, i)     pgm_read_byte((protocol) == PROTOCOL_EM4100 ? &em4100_frame[i] : &fdx_b_frame[i])
+
+static void injection_start(void)
+{
+	uint8_t sreg = SREG;
+	
+	stop_request = false;
+	is_stopped = false;
+	byte_index = 0;
+	frames_sent = 0;
+	frames_valid = 0;
+	overruns = 0;
+	
+	/* The RX interrupt also changes INTCTRLB */
+	cli();
+	READER_TIMER.CCB = READER_TIMER.CNT + byte_period;
+	READER_TIMER.INTFLAGS = TC1_CCBIF_bm;
+	READER_TIMER.INTCTRLB = (READER_TIMER.INTCTRLB & ~TC1_CCBINTLVL_gm) | (READER_RX_INT_LEVEL << 2);
+	SREG = sreg;
+}
+
+static void injection_stop(void)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	READER_TIMER.INTCTRLB &= ~TC1_CCBINTLVL_gm;
+	SREG = sreg;
+	
+	is_stopped = true;
+}
+
+#if READER_COUNT == 1
+ISR(TCD1_CCB_vect)
+{
+	uint8_t length = frame_length(protocol);
+	
+	uart0_rcv_byte_callback(frame_byte(protocol, byte_index));
+	
+	if (++byte_index < length)
+	{
+		READER_TIMER.CCB += byte_period;
+		return;
+	}
+	
+	/* Next frame once this one timed out */
+	byte_index = 0;
+	frames_sent++;
+	
+	if (stop_request)
+	{
+		injection_stop();
+		return;
+	}
+	
+	if (frames_mask == (B_PROTOCOL_EM4100 | B_PROTOCOL_FDX_B))
+		protocol = (protocol == PROTOCOL_EM4100) ? PROTOCOL_FDX_B : PROTOCOL_EM4100;
+	
+	READER_TIMER.CCB += readers[0].timeout + 2;
+}
+#endif
+
+/************************************************************************/
+/* Start and stop                                                       */
+/************************************************************************/
+bool self_test_start(uint8_t mask)
+{
+#if READER_COUNT > 1
+	return false;
+#endif
+	
+	mask &= app_regs.REG_READER_PROTOCOLS;
+	
+	if (mask == 0 || app_regs.REG_READER_INTERFACE != GM_READER_ASCII)
+		return false;
+	
+	if (is_running)
+		self_test_stop();
+	
+	frames_mask = mask;
+	protocol = (mask & B_PROTOCOL_EM4100) ? PROTOCOL_EM4100 : PROTOCOL_FDX_B;
+	
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_FPS] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_DROPPED] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_OVERRUNS] = 0;
+	app_regs.REG_SELF_TEST_RESULT[SELF_TEST_BYTE_PERIOD] = 0;
+	
+	/* Only the synthetic frames, the frame timeout learns from them */
+	rx_int_level = UART0_UART.CTRLA & USART_RXCINTLVL_gm;
+	UART0_UART.CTRLA &= ~USART_RXCINTLVL_gm;
+	reader_reset_timeouts();
+	
+	step = STEP_INJECTING;
+	step_ms = 0;
+	byte_period = readers[0].max_timeout / 5;
+	last_tick = reader_read_timer();
+	is_running = true;
+	
+	injection_start();
+	
+	return true;
+}
+
+void self_test_stop(void)
+{
+	if (!is_running)
+		return;
+	
+	injection_stop();
+	
+	is_running = false;
+	UART0_UART.CTRLA |= rx_int_level;
+	reader_reset_timeouts();
+	app_regs.REG_SELF_TEST = 0;
+}
+
+bool self_test_is_running(void)
+{
+	return is_running;
+}
+
+/************************************************************************/
+/* Measure                                                              */
+/************************************************************************/
+void self_test_frame(int8_t flags, uint64_t tag_id)
+{
+	if (flags < 0)
+		return;
+	
+	if (tag_id == EM4100_TAG_ID || tag_id == FDX_B_TAG_ID)
+		frames_valid++;
+}
+
+static bool end_step(void)
+{
+	uint16_t dropped = (frames_sent > frames_valid) ? frames_sent - frames_valid : 0;
+	uint16_t *result = app_regs.REG_SELF_TEST_RESULT;
+	
+	result[SELF_TEST_DROPPED] += dropped;
+	result[SELF_TEST_OVERRUNS] += overruns;
+	
+	if (dropped || overruns)
+		return false;
+	
+	/* The step lasts 1 s */
+	result[SELF_TEST_FPS] = frames_valid;
+	result[SELF_TEST_BYTE_PERIOD] = byte_period * 32;
+	
+	return byte_period > 1;
+}
+
+void self_test_tick_1ms(void)
+{
+	uint16_t ticks;
+	
+	if (!is_running)
+		return;
+	
+	ticks = reader_read_timer();
+	
+	if ((uint16_t)(ticks - last_tick) > SELF_TEST_LATE_TICK)
+		overruns++;
+	
+	last_tick = ticks;
+	step_ms++;
+	
+	switch (step)
+	{
+		case STEP_INJECTING:
+			if (step_ms == SELF_TEST_STEP_MS)
+			{
+				stop_request = true;
+				step = STEP_STOPPING;
+			}
+			break;
+	
+		case STEP_STOPPING:
+			if (is_stopped)
+			{
+				step_ms = 0;
+				step = STEP_DRAINING;
+			}
+			break;
+	
+		case STEP_DRAINING:
+			if (step_ms < SELF_TEST_DRAIN_MS)
+				break;
+	
+			if (end_step())
+			{
+				byte_period /= 2;
+				step_ms = 0;
+				step = STEP_INJECTING;
+				injection_start();
+			}
+			else
+			{
+				self_test_stop();
+				core_func_send_event(ADD_REG_SELF_TEST_RESULT, true);
+			}
+			break;
+	}
+}
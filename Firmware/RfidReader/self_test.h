@@ -0,0 +1,52 @@
+#ifndef _SELF_TEST_H_
+#define _SELF_TEST_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Throughput self-test                                                 */
+/*                                                                      */
+/* Feeds synthetic EM4100 and/or FDX-B frames to the first reader       */
+/* through uart0_rcv_byte_callback(), from READER_TIMER's compare       */
+/* channel B at the reader's RX level (MED), so they take the same path */
+/* as the module's bytes: frame timeout, queue and decoding. The frames */
+/* stop there, no events, matching or outputs.                          */
+/*                                                                      */
+/* Each step lasts 1 s, with the bytes a byte time of the baud rate     */
+/* apart, halved on each step down to 1 tick (32 us). Frames are a      */
+/* frame timeout apart, which learns from the synthetic bytes, so both  */
+/* shrink. The test stops after the last step or on the first step     */
+/* with frames dropped (lost or not decoded to the ID sent) or with a   */
+/* late 1 ms tick.                                                      */
+/*                                                                      */
+/* Reported on REG_SELF_TEST_RESULT, with an event: frames per second   */
+/* of the fastest step passed, frames dropped, 1 ms tick overruns, byte */
+/* period of the fastest step passed (us). The module's RX is off while */
+/* running. Not available with a second reader, which uses channel B.   */
+/************************************************************************/
+#define SELF_TEST_STEP_MS               1000
+#define SELF_TEST_DRAIN_MS              10          // After the last frame, for the timeout and the queue
+#define SELF_TEST_LATE_TICK             47          // READER_TIMER ticks, 1.5 ms
+
+#define SELF_TEST_FPS                   0
+#define SELF_TEST_DROPPED               1
+#define SELF_TEST_OVERRUNS              2
+#define SELF_TEST_BYTE_PERIOD           3
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+/* Returns false if the test can't run with this configuration */
+bool self_test_start(uint8_t frames_mask);
+void self_test_stop(void);
+bool self_test_is_running(void);
+
+/* Called for each frame while running, with the LOW level masked */
+void self_test_frame(int8_t flags, uint64_t tag_id);
+
+/* Called every millisecond (LOW level) */
+void self_test_tick_1ms(void);
+
+
+#endif /* _SELF_TEST_H_ */
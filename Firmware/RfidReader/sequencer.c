@@ -0,0 +1,164 @@
+#include <avr/pgmspace.h>
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "hwbp_core_types.h"
+#include "app.h"
+#include "app_ios_and_regs.h"
+#include "sequencer.h"
+
+extern AppRegs app_regs;
+extern bool stop_buzzer;
+
+
+/************************************************************************/
+/* Tones                                                                */
+/*                                                                      */
+/* The buzzer's pin is set on the overflow and cleared on CCA, so the   */
+/* tone is 32 MHz / prescaler / (period + 1). Third of an octave steps. */
+/************************************************************************/
+typedef struct
+{
+	uint8_t prescaler;
+	uint16_t period;
+} tone_t;
+
+static const tone_t tones[SEQUENCER_TONES] PROGMEM = {
+	{0, 0},                             // Silent
+	{TIMER_PRESCALER_DIV8, 9999},       // 400 Hz
+	{TIMER_PRESCALER_DIV8, 7999},       // 500 Hz
+	{TIMER_PRESCALER_DIV8, 6348},       // 630 Hz
+	{TIMER_PRESCALER_DIV8, 4999},       // 800 Hz
+	{TIMER_PRESCALER_DIV8, 3999},       // 1 KHz
+	{TIMER_PRESCALER_DIV8, 3199},       // 1.25 KHz
+	{TIMER_PRESCALER_DIV8, 2499},       // 1.6 KHz
+	{TIMER_PRESCALER_DIV8, 1999},       // 2 KHz
+	{TIMER_PRESCALER_DIV8, 1599},       // 2.5 KHz
+	{TIMER_PRESCALER_DIV8, 1269},       // 3.15 KHz
+	{TIMER_PRESCALER_DIV8, 999},        // 4 KHz
+	{TIMER_PRESCALER_DIV8, 799},        // 5 KHz
+	{TIMER_PRESCALER_DIV8, 634},        // 6.3 KHz
+	{TIMER_PRESCALER_DIV8, 499},        // 8 KHz
+	{TIMER_PRESCALER_DIV8, 399}         // 10 KHz
+};
+
+static void play_tone(uint8_t index)
+{
+	tone_t tone;
+	
+	if (index == 0)
+	{
+		/* Stops at the end of the period */
+		stop_buzzer = true;
+		return;
+	}
+	
+	memcpy_P(&tone, &tones[index], sizeof(tone_t));
+	
+	if (!stop_buzzer && (TCC0.CTRLA & TC0_CLKSEL_gm) == tone.prescaler)
+	{
+		/* Taken on the next overflow */
+		TCC0.PERBUF = tone.period;
+		TCC0.CCABUF = tone.period >> 1;
+	}
+	else
+	{
+		timer_type0_pwm(&TCC0, tone.prescaler, tone.period, tone.period >> 1, BUZZER_INT_LEVEL, BUZZER_INT_LEVEL);
+	}
+	
+	stop_buzzer = false;
+}
+
+/************************************************************************/
+/* Patterns                                                             */
+/************************************************************************/
+#define BOTH_LEDS                   (SEQUENCER_TOP_LED_bm | SEQUENCER_BOTTOM_LED_bm)
+
+static const uint8_t patterns[SEQUENCER_PATTERNS][SEQUENCER_STEPS * SEQUENCER_STEP_SIZE] PROGMEM = {
+	{BOTH_LEDS | 8, 10},                                                            // 2 KHz, 100 ms
+	{BOTH_LEDS | 8, 8, 0, 6, BOTH_LEDS | 8, 8},                                     // Two short beeps
+	{SEQUENCER_TOP_LED_bm | 5, 8, SEQUENCER_BOTTOM_LED_bm | 8, 8, BOTH_LEDS | 11, 8},  // Rising, 1, 2 and 4 KHz
+	{BOTH_LEDS | 4, 50}                                                             // 800 Hz, 500 ms
+};
+
+static bool is_playing = false;
+static uint8_t pattern_playing;
+static uint8_t next_step;               // Byte on the pattern
+static uint16_t step_ms;
+
+static uint8_t pattern_byte(uint8_t i)
+{
+	if (pattern_playing == SEQUENCER_USER_PATTERN)
+		return app_regs.REG_USER_PATTERN[i];
+	
+	return pgm_read_byte(&patterns[pattern_playing][i]);
+}
+
+static bool play_step(void)
+{
+	uint8_t output;
+	uint8_t duration;
+	
+	if (next_step == SEQUENCER_STEPS * SEQUENCER_STEP_SIZE)
+		return false;
+	
+	output = pattern_byte(next_step);
+	duration = pattern_byte(next_step + 1);
+	
+	if (duration == 0)
+		return false;
+	
+	play_tone(output & SEQUENCER_TONE_gm);
+	
+	if (core_bool_is_visual_enabled() && (output & SEQUENCER_TOP_LED_bm))
+		set_LED_DETECT_TOP;
+	else
+		clr_LED_DETECT_TOP;
+	
+	if (core_bool_is_visual_enabled() && (output & SEQUENCER_BOTTOM_LED_bm))
+		set_LED_DETECT_BOTTOM;
+	else
+		clr_LED_DETECT_BOTTOM;
+	
+	step_ms = duration * SEQUENCER_DURATION_MS;
+	next_step += SEQUENCER_STEP_SIZE;
+	
+	return true;
+}
+
+bool sequencer_play(uint8_t pattern)
+{
+	if (pattern > SEQUENCER_USER_PATTERN)
+		return false;
+	
+	pattern_playing = pattern;
+	next_step = 0;
+	
+	if (!play_step())
+		return false;
+	
+	is_playing = true;
+	return true;
+}
+
+void sequencer_stop(void)
+{
+	if (!is_playing)
+		return;
+	
+	is_playing = false;
+	stop_buzzer = true;
+	clr_LED_DETECT_TOP;
+	clr_LED_DETECT_BOTTOM;
+}
+
+void sequencer_tick_1ms(void)
+{
+	if (!is_playing)
+		return;
+	
+	if (--step_ms)
+		return;
+	
+	if (!play_step())
+		sequencer_stop();
+}
@@ -0,0 +1,45 @@
+#ifndef _SEQUENCER_H_
+#define _SEQUENCER_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Notification sequencer                                               */
+/*                                                                      */
+/* Plays patterns of up to 8 steps, each with a tone, the LEDs' state   */
+/* and a duration. A step with duration 0 ends the pattern. The built   */
+/* in patterns are read from the flash, the user's pattern from         */
+/* REG_USER_PATTERN. The tones are a table of prescaler and period, so  */
+/* a step only writes the buzzer timer's buffered PER and CCA, taken at */
+/* the end of the tone's period, from the 1 ms tick (LOW level).        */
+/*                                                                      */
+/* A pattern is selected by GM_PATTERN on the notifications (of the     */
+/* match entries, the rules and the notification registers) and then   */
+/* replaces their other bits, unless it's empty.                        */
+/************************************************************************/
+#define SEQUENCER_PATTERNS          4           // Built in
+#define SEQUENCER_USER_PATTERN      SEQUENCER_PATTERNS
+#define SEQUENCER_STEPS             8
+#define SEQUENCER_STEP_SIZE         2
+#define SEQUENCER_DURATION_MS       10          // Duration's unit, up to 2.55 s per step
+
+/* Step: output, then duration */
+#define SEQUENCER_TONE_gm           0x0F        // Index on the tones' table, 0 is silent
+#define SEQUENCER_TOP_LED_bm        (1<<4)
+#define SEQUENCER_BOTTOM_LED_bm     (1<<5)
+
+#define SEQUENCER_TONES             16
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+/* Returns false if the pattern is empty */
+bool sequencer_play(uint8_t pattern);
+void sequencer_stop(void);
+
+/* Called every millisecond (LOW level) */
+void sequencer_tick_1ms(void);
+
+
+#endif /* _SEQUENCER_H_ */
@@ -0,0 +1,44 @@
+#include "stack.h"
+
+
+/************************************************************************/
+/* Linker's symbols                                                     */
+/************************************************************************/
+extern uint8_t _end;                     // End of .bss
+extern uint8_t __stack;                  // Top of the stack, RAMEND
+
+
+/************************************************************************/
+/* Paint                                                                */
+/*                                                                      */
+/* Runs from .init3, once the stack pointer and the zero register are   */
+/* set and before .data and .bss are initialized. Naked and without     */
+/* calls, so it doesn't use the stack it paints. The pointer is         */
+/* volatile so the loop isn't turned into a call to memset().           */
+/************************************************************************/
+void stack_paint(void) __attribute__((naked, used, section(".init3")));
+
+void stack_paint(void)
+{
+	volatile uint8_t *p = &_end;
+	
+	while (p <= &__stack)
+		*p++ = STACK_PAINT;
+}
+
+
+/************************************************************************/
+/* High-water mark                                                      */
+/*                                                                      */
+/* Counts from the end of .bss, so it stops on the deepest byte the     */
+/* stack ever wrote and takes as long as the bytes still free.          */
+/************************************************************************/
+uint16_t stack_free(void)
+{
+	uint8_t *p = &_end;
+	
+	while (p <= &__stack && *p == STACK_PAINT)
+		p++;
+	
+	return p - &_end;
+}
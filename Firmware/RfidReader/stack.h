@@ -0,0 +1,25 @@
+#ifndef _STACK_H_
+#define _STACK_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Stack's high-water mark                                              */
+/*                                                                      */
+/* The SRAM from the end of .bss to the top of the stack is painted     */
+/* with STACK_PAINT at reset, before .data and .bss are initialized.    */
+/* The bytes at the bottom that still hold it were never reached by     */
+/* the stack, of the main loop and of the levels nested on top, the     */
+/* core's handlers included. Read on REG_STACK_FREE, see               */
+/* APP_STACK_RESERVE on app.h.                                          */
+/************************************************************************/
+#define STACK_PAINT                 0xC5
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+uint16_t stack_free(void);
+
+
+#endif /* _STACK_H_ */
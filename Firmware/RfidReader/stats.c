@@ -0,0 +1,55 @@
+#include <string.h>
+#include "stats.h"
+
+
+static uint16_t stats[4];
+static uint16_t unique_hashes[STATS_UNIQUE_SLOTS];
+
+static uint16_t hash_tag_id(uint64_t tag_id)
+{
+	uint16_t *words = (uint16_t*)&tag_id;
+	
+	/* 0 marks an empty slot */
+	return (words[0] ^ words[1] ^ words[2] ^ words[3]) | 1;
+}
+
+void stats_detection(uint64_t tag_id)
+{
+	uint16_t hash = hash_tag_id(tag_id);
+	uint8_t i;
+	
+	stats[STATS_DETECTIONS]++;
+	
+	for (i = 0; i < STATS_UNIQUE_SLOTS; i++)
+	{
+		if (unique_hashes[i] == hash)
+			return;
+		
+		if (unique_hashes[i] == 0)
+		{
+			unique_hashes[i] = hash;
+			break;
+		}
+	}
+	
+	/* Counted again if the table is full */
+	stats[STATS_UNIQUE_TAGS]++;
+}
+
+void stats_frame_error(void)
+{
+	stats[STATS_FRAME_ERRORS]++;
+}
+
+void stats_tick_1ms(bool tag_in_range)
+{
+	if (tag_in_range)
+		stats[STATS_DWELL_MS]++;
+}
+
+void stats_new_second(uint16_t *reg)
+{
+	memcpy(reg, stats, sizeof(stats));
+	memset(stats, 0, sizeof(stats));
+	memset(unique_hashes, 0, sizeof(unique_hashes));
+}
@@ -0,0 +1,35 @@
+#ifndef _STATS_H_
+#define _STATS_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Statistics                                                           */
+/*                                                                      */
+/* Accumulated during each second and published on REG_STATS by the     */
+/* core's new second callback. Everything runs at LOW level.            */
+/*                                                                      */
+/* The unique tags are counted with a small table of hashes, so the     */
+/* count is exact up to STATS_UNIQUE_SLOTS tags, barring collisions,    */
+/* and an upper bound beyond.                                           */
+/************************************************************************/
+#define STATS_DETECTIONS            0
+#define STATS_UNIQUE_TAGS           1
+#define STATS_DWELL_MS              2
+#define STATS_FRAME_ERRORS          3
+
+#define STATS_UNIQUE_SLOTS          4
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void stats_detection(uint64_t tag_id);
+void stats_frame_error(void);
+void stats_tick_1ms(bool tag_in_range);
+
+/* Copy the last second to the register and start a new one */
+void stats_new_second(uint16_t *reg);
+
+
+#endif /* _STATS_H_ */
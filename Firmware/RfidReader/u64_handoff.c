@@ -0,0 +1,35 @@
+#include "u64_handoff.h"
+
+
+/************************************************************************/
+/* Prevents the compiler from moving memory accesses across this point  */
+/************************************************************************/
+#define memory_barrier() __asm volatile("" ::: "memory")
+
+
+/************************************************************************/
+/* Producer                                                             */
+/************************************************************************/
+void u64_handoff_write(u64_handoff_t *handoff, uint64_t *reg, uint64_t value)
+{
+	handoff->copy_is_written = true;
+	memory_barrier();
+	handoff->copy = value;
+	memory_barrier();
+	handoff->copy_is_written = false;
+	memory_barrier();
+	*reg = value;
+}
+
+
+/************************************************************************/
+/* Consumers, preempting the producer                                   */
+/************************************************************************/
+void u64_handoff_read(u64_handoff_t *handoff, uint64_t *reg)
+{
+	/* The register is still complete */
+	if (handoff->copy_is_written)
+		return;
+	
+	*reg = handoff->copy;
+}
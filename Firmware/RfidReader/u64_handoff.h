@@ -0,0 +1,34 @@
+#ifndef _U64_HANDOFF_H_
+#define _U64_HANDOFF_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Lock-free handoff of 64 bits registers                               */
+/*                                                                      */
+/* One context writes the register (the producer), the others only read */
+/* it and preempt the producer, never the opposite. The producer keeps  */
+/* a complete copy of the value before it writes the register, flagged  */
+/* while the copy itself is written. A reader that preempts it copies   */
+/* the complete value to the register, or leaves the register as it is  */
+/* if the producer didn't touch it yet, so it never sees a half written */
+/* value and the interrupts are never disabled.                         */
+/*                                                                      */
+/* The tag ID producers run on the main loop, the readers are the       */
+/* core's command handler, on the HIGH level of its UART's RX.          */
+/************************************************************************/
+typedef struct
+{
+	volatile bool copy_is_written;
+	uint64_t copy;
+} u64_handoff_t;
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void u64_handoff_write(u64_handoff_t *handoff, uint64_t *reg, uint64_t value);
+void u64_handoff_read(u64_handoff_t *handoff, uint64_t *reg);
+
+
+#endif /* _U64_HANDOFF_H_ */
@@ -63,7 +63,8 @@ void uart0_enable(void)
 
 void uart0_disable(void)
 {
-	UART0_UART.CTRLB &= (USART_RXEN_bm | USART_TXEN_bm);
+	UART0_UART.CTRLA &= ~USART_RXCINTLVL_gm;
+	UART0_UART.CTRLB &= ~(USART_RXEN_bm | USART_TXEN_bm);
 }
 
 /************************************************************************/
@@ -189,5 +190,5 @@ UART0_RX_ROUTINE_
 	//disable_uart0_rx;
 	uart0_rcv_byte_callback(UART0_DATA);
 	//enable_uart0_rx;
-	uart0_leave_interrupt;
+	uart0_rx_leave_interrupt;
 }
\ No newline at end of file
@@ -7,12 +7,12 @@
 /************************************************************************/
 /* UART definitions                                                     */
 /************************************************************************/
-#define UART0_RX_INT_LEVEL    INT_LEVEL_LOW
+#define UART0_RX_INT_LEVEL    INT_LEVEL_MED     // Check the priorities on app.h
 #define UART0_TX_INT_LEVEL    INT_LEVEL_LOW
 #define UART0_CTS_INT_LEVEL   INT_LEVEL_LOW
 
-#define UART0_RXBUFSIZ			64
-#define UART0_TXBUFSIZ			8
+#define UART0_RXBUFSIZ			1		// The frames are kept on the reader's context (reader.h)
+#define UART0_TXBUFSIZ			1		// Nothing is sent to the reader module
 
 #define UART0_UART				USARTD0	
 #define UART0_PORT				PORTD
@@ -20,8 +20,8 @@
 #define UART0_RX_pin			2
 #define UART0_TX_pin			3
 
-#define UART0_RX_ROUTINE_		ISR(USARTD0_RXC_vect, ISR_NAKED)
-#define UART0_TX_ROUTINE_		ISR(USARTD0_DRE_vect, ISR_NAKED)
+#define UART0_RX_ROUTINE_		ISR(USARTD0_RXC_vect)	// Not naked, it preempts LOW level code
+#define UART0_TX_ROUTINE_		ISR(USARTD0_DRE_vect)
 
 
 //#define UART0_USE_FLOW_CONTROL	// comment this line if don't use
@@ -30,10 +30,11 @@
 #define UART0_CTS_PORT			PORTD
 #define UART0_CTS_pin			7
 
-#define UART0_CTS_ROUTINE_		ISR(PORTD_INT0_vect, ISR_NAKED)
+#define UART0_CTS_ROUTINE_		ISR(PORTD_INT0_vect)
 #define UART0_CTS_INT_N			0
 
-#define uart0_leave_interrupt /*return*/reti()
+#define uart0_leave_interrupt return
+#define uart0_rx_leave_interrupt return
 
 /************************************************************************/
 /* Prototypes                                                           */
@@ -41,6 +42,10 @@
 #define disable_uart0_rx set_io(UART0_RTS_PORT, UART0_RTS_pin)
 #define enable_uart0_rx	 clear_io(UART0_RTS_PORT, UART0_RTS_pin)
 
+/* Mask the RX interrupt, the received bytes wait on the UART's FIFO */
+#define uart0_rx_int_disable	UART0_UART.CTRLA &= ~USART_RXCINTLVL_gm
+#define uart0_rx_int_enable	UART0_UART.CTRLA |= (UART0_RX_INT_LEVEL << 4)
+
 void uart0_init(uint16_t BSEL, int8_t BSCALE, bool use_clk2x);
 void uart0_enable(void);
 void uart0_disable();
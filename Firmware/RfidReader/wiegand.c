@@ -0,0 +1,76 @@
+#include "cpu.h"
+#include "wiegand.h"
+
+
+#define bit_is_set(bits, i)     ((bits)[(i) >> 3] & (0x80 >> ((i) & 7)))
+
+/************************************************************************/
+/* Enable and disable                                                   */
+/************************************************************************/
+void wiegand_enable(void)
+{
+	io_pin2in(&WIEGAND_PORT, WIEGAND_D0_pin, PULL_IO_UP, SENSE_IO_EDGE_FALLING);
+	io_pin2in(&WIEGAND_PORT, WIEGAND_D1_pin, PULL_IO_UP, SENSE_IO_EDGE_FALLING);
+	io_set_int(&WIEGAND_PORT, WIEGAND_INT_LEVEL, WIEGAND_INT_N, (1<<WIEGAND_D0_pin) | (1<<WIEGAND_D1_pin), true);
+}
+
+void wiegand_disable(void)
+{
+	io_set_int(&WIEGAND_PORT, INT_LEVEL_OFF, WIEGAND_INT_N, 0, true);
+	
+	io_pin2in(&WIEGAND_PORT, WIEGAND_D0_pin, PULL_IO_TRISTATE, SENSE_IO_NO_INT_USED);
+	io_pin2in(&WIEGAND_PORT, WIEGAND_D1_pin, PULL_IO_TRISTATE, SENSE_IO_NO_INT_USED);
+}
+
+/************************************************************************/
+/* Falling edges                                                        */
+/************************************************************************/
+WIEGAND_ROUTINE_
+{
+	/* D1 low is a 1, D0 low is a 0 */
+	wiegand_rcv_bit_callback(!read_io(WIEGAND_PORT, WIEGAND_D1_pin));
+}
+
+/************************************************************************/
+/* Decode                                                               */
+/************************************************************************/
+/* First bit is the even parity of the first half, last bit is the odd parity of the second half */
+bool wiegand_decode(const uint8_t *bits, uint8_t n_bits, uint64_t *tag_id)
+{
+	uint8_t half = n_bits / 2;
+	uint8_t ones = 0;
+	uint8_t i;
+	
+	if (n_bits != 26 && n_bits != 34)
+		return false;
+	
+	/* Check parity */
+	for (i = 0; i < half; i++)
+		if (bit_is_set(bits, i))
+			ones++;
+	
+	if (ones & 1)
+		return false;
+	
+	ones = 0;
+	
+	for (i = half; i < n_bits; i++)
+		if (bit_is_set(bits, i))
+			ones++;
+	
+	if (!(ones & 1))
+		return false;
+	
+	/* The ID is between the parity bits, MSB first */
+	*tag_id = 0;
+	
+	for (i = 1; i < n_bits - 1; i++)
+	{
+		*tag_id <<= 1;
+		
+		if (bit_is_set(bits, i))
+			*tag_id |= 1;
+	}
+	
+	return true;
+}
@@ -0,0 +1,39 @@
+#ifndef _WIEGAND_H_
+#define _WIEGAND_H_
+#include "cpu.h"
+
+
+/************************************************************************/
+/* Wiegand input                                                        */
+/*                                                                      */
+/* The reader module pulses D0 low for a 0 and D1 low for a 1. Each     */
+/* falling edge calls wiegand_rcv_bit_callback() with the bit, which    */
+/* keeps it on the reader's buffer, MSB first, and restarts the frame   */
+/* timeout, like a byte received on the UART.                           */
+/*                                                                      */
+/* D0 is the same line the module uses for the ASCII output, so the     */
+/* UART's receiver must be disabled while Wiegand is used.              */
+/************************************************************************/
+#define WIEGAND_INT_LEVEL       INT_LEVEL_MED     // Check the priorities on app.h
+
+#define WIEGAND_PORT            PORTD
+#define WIEGAND_D0_pin          2
+#define WIEGAND_D1_pin          5
+#define WIEGAND_INT_N           1
+
+#define WIEGAND_ROUTINE_        ISR(PORTD_INT1_vect)	// Not naked, it preempts LOW level code
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void wiegand_enable(void);
+void wiegand_disable(void);
+
+void wiegand_rcv_bit_callback(bool bit);
+
+/* Decode Wiegand 26 or 34 bits, bits are stored MSB first */
+bool wiegand_decode(const uint8_t *bits, uint8_t n_bits, uint64_t *tag_id);
+
+
+#endif /* _WIEGAND_H_ */
@@ -0,0 +1,94 @@
+#include "cpu.h"
+#include "hwbp_core_types.h"
+#include "app_ios_and_regs.h"
+#include "work.h"
+
+extern AppRegs app_regs;
+
+
+static work_t queue[WORK_QUEUE_SIZE];
+static uint8_t queue_head = 0;
+static uint8_t queue_count = 0;
+
+static void pop(void)
+{
+	queue_head = (queue_head + 1) % WORK_QUEUE_SIZE;
+	queue_count--;
+}
+
+static void report_wait(work_t *item)
+{
+	uint16_t wait = reader_read_timer() - item->queued_ticks;
+	
+	/* 32 us per tick */
+	wait = (wait < 0xFFFF / 32) ? wait * 32 : 0xFFFF;
+	
+	if (wait > app_regs.REG_WORK_QUEUE[WORK_WORST_WAIT])
+		app_regs.REG_WORK_QUEUE[WORK_WORST_WAIT] = wait;
+}
+
+/************************************************************************/
+/* Queue, at LOW level                                                  */
+/************************************************************************/
+bool work_alloc(uint8_t type, uint8_t reader)
+{
+	work_t *item;
+	
+	if (queue_count == WORK_QUEUE_SIZE)
+		return false;
+	
+	item = &queue[(queue_head + queue_count) % WORK_QUEUE_SIZE];
+	item->type = type;
+	item->reader = reader;
+	item->queued_ticks = reader_read_timer();
+	
+	return true;
+}
+
+void work_push(void)
+{
+	queue_count++;
+	
+	if (queue_count > app_regs.REG_WORK_QUEUE[WORK_MAX_DEPTH])
+		app_regs.REG_WORK_QUEUE[WORK_MAX_DEPTH] = queue_count;
+}
+
+void work_drop(void)
+{
+	if (app_regs.REG_WORK_QUEUE[WORK_DROPPED] < 0xFFFF)
+		app_regs.REG_WORK_QUEUE[WORK_DROPPED]++;
+}
+
+/************************************************************************/
+/* Main loop                                                            */
+/************************************************************************/
+void work_task(void)
+{
+	uint8_t pmic_ctrl = PMIC.CTRL;
+	work_t item;
+	uint64_t tag_id;
+	int8_t flags;
+	
+	/* The LOW handlers also use the queue and call the core */
+	PMIC.CTRL = pmic_ctrl & ~PMIC_LOLVLEN_bm;
+	
+	if (queue_count == 0)
+	{
+		PMIC.CTRL = pmic_ctrl;
+		return;
+	}
+	
+	item = queue[queue_head];
+	report_wait(&item);
+	work_take(&item);
+	
+	PMIC.CTRL = pmic_ctrl;
+	
+	/* The frame stays on REG_RAW_FRAME until the item is done */
+	flags = work_decode(&item, &tag_id);
+	
+	PMIC.CTRL = pmic_ctrl & ~PMIC_LOLVLEN_bm;
+	work_do(&item, flags, tag_id);
+	pop();
+	PMIC.CTRL = pmic_ctrl;
+}
@@ -0,0 +1,67 @@
+#ifndef _WORK_H_
+#define _WORK_H_
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "reader.h"
+
+
+/************************************************************************/
+/* Bottom half                                                          */
+/*                                                                      */
+/* The frame timeouts and the 1 ms tick (LOW level) only take the frame */
+/* or the TAG_IN_RANGE edge and queue it. The main loop decodes the     */
+/* frames and does the rest: matching, events and notifications.        */
+/*                                                                      */
+/* An item is only its type and reader. The oldest frame is taken to    */
+/* REG_RAW_FRAME and stays there until its item is done, the next ones  */
+/* are held on their reader's buffer until then, so each reader has two */
+/* frames' buffers.                                                     */
+/*                                                                      */
+/* The LOW handlers also call the core, so the main loop masks the LOW  */
+/* level while it does, but not while it decodes. The item stays on the */
+/* queue until it's done. The LOW handlers never do the work: a frame   */
+/* with no room, on the queue or on the reader's buffer, is dropped and */
+/* counted, and the TAG_IN_RANGE edges wait on the 1 ms tick.           */
+/*                                                                      */
+/* Reported on REG_WORK_QUEUE: maximum depth, worst wait from the queue */
+/* to the start of the work (us) and the frames dropped.                */
+/************************************************************************/
+#define WORK_QUEUE_SIZE             (READER_COUNT + 3)    // A frame on REG_RAW_FRAME, one held per reader and both edges
+
+#define WORK_UART_FRAME             0
+#define WORK_WIEGAND_FRAME          1
+#define WORK_TAG_ENTERED            2
+#define WORK_TAG_LEFT               3
+
+#define work_is_frame(type)         ((type) <= WORK_WIEGAND_FRAME)
+
+typedef struct
+{
+	uint8_t type;
+	uint8_t reader;                     // The frame is on REG_RAW_FRAME, or held on this reader's buffer
+	uint16_t queued_ticks;              // READER_TIMER
+} work_t;
+
+#define WORK_MAX_DEPTH              0
+#define WORK_WORST_WAIT             1
+#define WORK_DROPPED                2
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+/* Called at LOW level, false if the queue is full, the item is queued by work_push() */
+bool work_alloc(uint8_t type, uint8_t reader);
+void work_push(void);
+void work_drop(void);
+
+/* Called from the main loop */
+void work_task(void);
+
+/* Implemented with the detection logic, on the main loop */
+void work_take(work_t *item);           // LOW level masked
+int8_t work_decode(work_t *item, uint64_t *tag_id);
+void work_do(work_t *item, int8_t flags, uint64_t tag_id);  // LOW level masked
+
+
+#endif /* _WORK_H_ */
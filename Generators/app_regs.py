@@ -0,0 +1,120 @@
+"""Generates the registers' tables of app_ios_and_regs.c from device.yml.
+
+The registers' names are taken from the ADD_REG_ defines of
+app_ios_and_regs.h, which is also checked against device.yml: the type
+and length of each register on AppRegs, APP_REGS_ADD_MAX and
+APP_NBYTES_OF_REG_BANK.
+
+    python app_regs.py           rewrites the tables
+    python app_regs.py --check   fails if the tables are out of date
+"""
+
+import os
+import re
+import sys
+
+import yaml
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+DEVICE = os.path.join(ROOT, 'device.yml')
+FIRMWARE = os.path.join(ROOT, 'Firmware', 'RfidReader')
+HEADER = os.path.join(FIRMWARE, 'app_ios_and_regs.h')
+SOURCE = os.path.join(FIRMWARE, 'app_ios_and_regs.c')
+
+APP_REGS_ADD_MIN = 0x20
+SIZES = {'U8': 1, 'U16': 2, 'U32': 4, 'U64': 8}
+
+
+def fail(message):
+    sys.exit('app_regs.py: ' + message)
+
+
+def load_registers():
+    with open(DEVICE) as f:
+        device = yaml.safe_load(f)
+    registers = sorted(device['registers'].items(), key=lambda r: r[1]['address'])
+    for index, (name, register) in enumerate(registers):
+        if register['address'] != APP_REGS_ADD_MIN + index:
+            fail('%s is at %d, the registers must follow each other from %d'
+                 % (name, register['address'], APP_REGS_ADD_MIN))
+        if register['type'] not in SIZES:
+            fail('%s is %s, only unsigned types are supported' % (name, register['type']))
+    return registers
+
+
+def check_header(header, registers):
+    names = {int(a): n for n, a in re.findall(r'#define ADD_(REG_\w+)\s+(\d+)', header)}
+    struct = header[header.index('typedef struct'):header.index('} AppRegs;')]
+    fields = {n: (int(b), int(l or 1)) for b, n, l in
+              re.findall(r'uint(\d+)_t (REG_\w+)(?:\[(\d+)\])?;', struct)}
+    nbytes = 0
+    c_names = []
+    for name, register in registers:
+        address = register['address']
+        if address not in names:
+            fail('no ADD_REG_ define for %s at %d' % (name, address))
+        c_name = names[address]
+        bits = SIZES[register['type']] * 8
+        length = register.get('length', 1)
+        if fields.get(c_name) != (bits, length):
+            fail('%s of AppRegs is not uint%d_t[%d] as %s' % (c_name, bits, length, name))
+        nbytes += bits // 8 * length
+        c_names.append(c_name)
+    add_max = int(re.search(r'#define APP_REGS_ADD_MAX\s+(\w+)', header).group(1), 0)
+    if add_max != registers[-1][1]['address']:
+        fail('APP_REGS_ADD_MAX is 0x%X, not 0x%X' % (add_max, registers[-1][1]['address']))
+    bank = int(re.search(r'#define APP_NBYTES_OF_REG_BANK\s+(\d+)', header).group(1))
+    if bank != nbytes:
+        fail('APP_NBYTES_OF_REG_BANK is %d, not %d' % (bank, nbytes))
+    return c_names
+
+
+def tables(registers, c_names):
+    type_ = []
+    n_elements = []
+    pointer = []
+    minimum = []
+    maximum = []
+    for (name, register), c_name in zip(registers, c_names):
+        length = register.get('length', 1)
+        type_.append('TYPE_' + register['type'])
+        n_elements.append(str(length))
+        if length > 1:
+            pointer.append('(uint8_t*)(app_regs.%s)' % c_name)
+        else:
+            pointer.append('(uint8_t*)(&app_regs.%s)' % c_name)
+        minimum.append(str(register.get('minValue', 0)))
+        maximum.append(str(register['maxValue']) if 'maxValue' in register else '0xFFFF')
+    return {
+        'uint8_t app_regs_type[]': type_,
+        'uint16_t app_regs_n_elements[]': n_elements,
+        'uint8_t *app_regs_pointer[]': pointer,
+        'const uint16_t app_regs_min[] PROGMEM': minimum,
+        'const uint16_t app_regs_max[] PROGMEM': maximum,
+    }
+
+
+def main():
+    check = '--check' in sys.argv[1:]
+    registers = load_registers()
+    with open(HEADER) as f:
+        c_names = check_header(f.read(), registers)
+    with open(SOURCE) as f:
+        source = f.read()
+    generated = source
+    for declaration, values in tables(registers, c_names).items():
+        pattern = re.compile(r'(%s = \{\n).*?(\n\};)' % re.escape(declaration), re.DOTALL)
+        if not pattern.search(generated):
+            fail('%s not found on app_ios_and_regs.c' % declaration)
+        body = ',\n'.join('\t' + v for v in values)
+        generated = pattern.sub(lambda m: m.group(1) + body + m.group(2), generated)
+    if generated == source:
+        return
+    if check:
+        fail('the tables of app_ios_and_regs.c are out of date, run app_regs.py')
+    with open(SOURCE, 'w') as f:
+        f.write(generated)
+
+
+if __name__ == '__main__':
+    main()
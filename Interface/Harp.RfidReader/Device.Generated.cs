@@ -57,7 +57,44 @@ namespace Harp.RfidReader
             { 51, typeof(MatchTagId2PulseWidth) },
             { 52, typeof(MatchTagId3PulseWidth) },
             { 53, typeof(AnyTagIdPulseWidth) },
-            { 54, typeof(DO0PulseWidth) }
+            { 54, typeof(DO0PulseWidth) },
+            { 55, typeof(DetectionLogConfig) },
+            { 56, typeof(DetectionLogPending) },
+            { 57, typeof(DetectionLogRecords) },
+            { 58, typeof(DetectionLogAck) },
+            { 59, typeof(ConfigImage) },
+            { 60, typeof(MatchTable) },
+            { 61, typeof(RawFrameConfig) },
+            { 62, typeof(RawFrame) },
+            { 63, typeof(ReaderProtocols) },
+            { 64, typeof(ReaderInterface) },
+            { 65, typeof(TagIdAntenna) },
+            { 66, typeof(EventConfig) },
+            { 67, typeof(InboundMatchIndex) },
+            { 68, typeof(OutboundMatchIndex) },
+            { 69, typeof(UnmatchedDetectionId) },
+            { 70, typeof(StatisticsConfig) },
+            { 71, typeof(Statistics) },
+            { 72, typeof(PresenceQuality) },
+            { 73, typeof(LatencyHistogram) },
+            { 74, typeof(Rules) },
+            { 75, typeof(SuppressedActivations) },
+            { 76, typeof(TagPresent) },
+            { 77, typeof(TagPresentPulseWidth) },
+            { 78, typeof(TagPresentNotifications) },
+            { 79, typeof(Out0Gate) },
+            { 80, typeof(Out0GateMinimumPulse) },
+            { 81, typeof(Out0GateHoldOff) },
+            { 82, typeof(TagInRangeFilter) },
+            { 83, typeof(TagInRangeGlitches) },
+            { 84, typeof(WorkQueue) },
+            { 85, typeof(SelfTest) },
+            { 86, typeof(SelfTestResult) },
+            { 87, typeof(ReaderBaudRate) },
+            { 88, typeof(FrameTiming) },
+            { 89, typeof(UserPattern) },
+            { 90, typeof(StackFree) },
+            { 91, typeof(HandlerTimes) }
         };
     }
 
@@ -107,6 +144,43 @@ namespace Harp.RfidReader
     /// <seealso cref="MatchTagId3PulseWidth"/>
     /// <seealso cref="AnyTagIdPulseWidth"/>
     /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DetectionLogConfig"/>
+    /// <seealso cref="DetectionLogPending"/>
+    /// <seealso cref="DetectionLogRecords"/>
+    /// <seealso cref="DetectionLogAck"/>
+    /// <seealso cref="ConfigImage"/>
+    /// <seealso cref="MatchTable"/>
+    /// <seealso cref="RawFrameConfig"/>
+    /// <seealso cref="RawFrame"/>
+    /// <seealso cref="ReaderProtocols"/>
+    /// <seealso cref="ReaderInterface"/>
+    /// <seealso cref="TagIdAntenna"/>
+    /// <seealso cref="EventConfig"/>
+    /// <seealso cref="InboundMatchIndex"/>
+    /// <seealso cref="OutboundMatchIndex"/>
+    /// <seealso cref="UnmatchedDetectionId"/>
+    /// <seealso cref="StatisticsConfig"/>
+    /// <seealso cref="Statistics"/>
+    /// <seealso cref="PresenceQuality"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="Rules"/>
+    /// <seealso cref="SuppressedActivations"/>
+    /// <seealso cref="TagPresent"/>
+    /// <seealso cref="TagPresentPulseWidth"/>
+    /// <seealso cref="TagPresentNotifications"/>
+    /// <seealso cref="Out0Gate"/>
+    /// <seealso cref="Out0GateMinimumPulse"/>
+    /// <seealso cref="Out0GateHoldOff"/>
+    /// <seealso cref="TagInRangeFilter"/>
+    /// <seealso cref="TagInRangeGlitches"/>
+    /// <seealso cref="WorkQueue"/>
+    /// <seealso cref="SelfTest"/>
+    /// <seealso cref="SelfTestResult"/>
+    /// <seealso cref="ReaderBaudRate"/>
+    /// <seealso cref="FrameTiming"/>
+    /// <seealso cref="UserPattern"/>
+    /// <seealso cref="StackFree"/>
+    /// <seealso cref="HandlerTimes"/>
     [XmlInclude(typeof(InboundDetectionId))]
     [XmlInclude(typeof(OutboundDetectionId))]
     [XmlInclude(typeof(DO0State))]
@@ -128,6 +202,43 @@ namespace Harp.RfidReader
     [XmlInclude(typeof(MatchTagId3PulseWidth))]
     [XmlInclude(typeof(AnyTagIdPulseWidth))]
     [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DetectionLogConfig))]
+    [XmlInclude(typeof(DetectionLogPending))]
+    [XmlInclude(typeof(DetectionLogRecords))]
+    [XmlInclude(typeof(DetectionLogAck))]
+    [XmlInclude(typeof(ConfigImage))]
+    [XmlInclude(typeof(MatchTable))]
+    [XmlInclude(typeof(RawFrameConfig))]
+    [XmlInclude(typeof(RawFrame))]
+    [XmlInclude(typeof(ReaderProtocols))]
+    [XmlInclude(typeof(ReaderInterface))]
+    [XmlInclude(typeof(TagIdAntenna))]
+    [XmlInclude(typeof(EventConfig))]
+    [XmlInclude(typeof(InboundMatchIndex))]
+    [XmlInclude(typeof(OutboundMatchIndex))]
+    [XmlInclude(typeof(UnmatchedDetectionId))]
+    [XmlInclude(typeof(StatisticsConfig))]
+    [XmlInclude(typeof(Statistics))]
+    [XmlInclude(typeof(PresenceQuality))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(Rules))]
+    [XmlInclude(typeof(SuppressedActivations))]
+    [XmlInclude(typeof(TagPresent))]
+    [XmlInclude(typeof(TagPresentPulseWidth))]
+    [XmlInclude(typeof(TagPresentNotifications))]
+    [XmlInclude(typeof(Out0Gate))]
+    [XmlInclude(typeof(Out0GateMinimumPulse))]
+    [XmlInclude(typeof(Out0GateHoldOff))]
+    [XmlInclude(typeof(TagInRangeFilter))]
+    [XmlInclude(typeof(TagInRangeGlitches))]
+    [XmlInclude(typeof(WorkQueue))]
+    [XmlInclude(typeof(SelfTest))]
+    [XmlInclude(typeof(SelfTestResult))]
+    [XmlInclude(typeof(ReaderBaudRate))]
+    [XmlInclude(typeof(FrameTiming))]
+    [XmlInclude(typeof(UserPattern))]
+    [XmlInclude(typeof(StackFree))]
+    [XmlInclude(typeof(HandlerTimes))]
     [Description("Filters register-specific messages reported by the RfidReader device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -170,6 +281,43 @@ namespace Harp.RfidReader
     /// <seealso cref="MatchTagId3PulseWidth"/>
     /// <seealso cref="AnyTagIdPulseWidth"/>
     /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DetectionLogConfig"/>
+    /// <seealso cref="DetectionLogPending"/>
+    /// <seealso cref="DetectionLogRecords"/>
+    /// <seealso cref="DetectionLogAck"/>
+    /// <seealso cref="ConfigImage"/>
+    /// <seealso cref="MatchTable"/>
+    /// <seealso cref="RawFrameConfig"/>
+    /// <seealso cref="RawFrame"/>
+    /// <seealso cref="ReaderProtocols"/>
+    /// <seealso cref="ReaderInterface"/>
+    /// <seealso cref="TagIdAntenna"/>
+    /// <seealso cref="EventConfig"/>
+    /// <seealso cref="InboundMatchIndex"/>
+    /// <seealso cref="OutboundMatchIndex"/>
+    /// <seealso cref="UnmatchedDetectionId"/>
+    /// <seealso cref="StatisticsConfig"/>
+    /// <seealso cref="Statistics"/>
+    /// <seealso cref="PresenceQuality"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="Rules"/>
+    /// <seealso cref="SuppressedActivations"/>
+    /// <seealso cref="TagPresent"/>
+    /// <seealso cref="TagPresentPulseWidth"/>
+    /// <seealso cref="TagPresentNotifications"/>
+    /// <seealso cref="Out0Gate"/>
+    /// <seealso cref="Out0GateMinimumPulse"/>
+    /// <seealso cref="Out0GateHoldOff"/>
+    /// <seealso cref="TagInRangeFilter"/>
+    /// <seealso cref="TagInRangeGlitches"/>
+    /// <seealso cref="WorkQueue"/>
+    /// <seealso cref="SelfTest"/>
+    /// <seealso cref="SelfTestResult"/>
+    /// <seealso cref="ReaderBaudRate"/>
+    /// <seealso cref="FrameTiming"/>
+    /// <seealso cref="UserPattern"/>
+    /// <seealso cref="StackFree"/>
+    /// <seealso cref="HandlerTimes"/>
     [XmlInclude(typeof(InboundDetectionId))]
     [XmlInclude(typeof(OutboundDetectionId))]
     [XmlInclude(typeof(DO0State))]
@@ -191,6 +339,43 @@ namespace Harp.RfidReader
     [XmlInclude(typeof(MatchTagId3PulseWidth))]
     [XmlInclude(typeof(AnyTagIdPulseWidth))]
     [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DetectionLogConfig))]
+    [XmlInclude(typeof(DetectionLogPending))]
+    [XmlInclude(typeof(DetectionLogRecords))]
+    [XmlInclude(typeof(DetectionLogAck))]
+    [XmlInclude(typeof(ConfigImage))]
+    [XmlInclude(typeof(MatchTable))]
+    [XmlInclude(typeof(RawFrameConfig))]
+    [XmlInclude(typeof(RawFrame))]
+    [XmlInclude(typeof(ReaderProtocols))]
+    [XmlInclude(typeof(ReaderInterface))]
+    [XmlInclude(typeof(TagIdAntenna))]
+    [XmlInclude(typeof(EventConfig))]
+    [XmlInclude(typeof(InboundMatchIndex))]
+    [XmlInclude(typeof(OutboundMatchIndex))]
+    [XmlInclude(typeof(UnmatchedDetectionId))]
+    [XmlInclude(typeof(StatisticsConfig))]
+    [XmlInclude(typeof(Statistics))]
+    [XmlInclude(typeof(PresenceQuality))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(Rules))]
+    [XmlInclude(typeof(SuppressedActivations))]
+    [XmlInclude(typeof(TagPresent))]
+    [XmlInclude(typeof(TagPresentPulseWidth))]
+    [XmlInclude(typeof(TagPresentNotifications))]
+    [XmlInclude(typeof(Out0Gate))]
+    [XmlInclude(typeof(Out0GateMinimumPulse))]
+    [XmlInclude(typeof(Out0GateHoldOff))]
+    [XmlInclude(typeof(TagInRangeFilter))]
+    [XmlInclude(typeof(TagInRangeGlitches))]
+    [XmlInclude(typeof(WorkQueue))]
+    [XmlInclude(typeof(SelfTest))]
+    [XmlInclude(typeof(SelfTestResult))]
+    [XmlInclude(typeof(ReaderBaudRate))]
+    [XmlInclude(typeof(FrameTiming))]
+    [XmlInclude(typeof(UserPattern))]
+    [XmlInclude(typeof(StackFree))]
+    [XmlInclude(typeof(HandlerTimes))]
     [XmlInclude(typeof(TimestampedInboundDetectionId))]
     [XmlInclude(typeof(TimestampedOutboundDetectionId))]
     [XmlInclude(typeof(TimestampedDO0State))]
@@ -212,6 +397,43 @@ namespace Harp.RfidReader
     [XmlInclude(typeof(TimestampedMatchTagId3PulseWidth))]
     [XmlInclude(typeof(TimestampedAnyTagIdPulseWidth))]
     [XmlInclude(typeof(TimestampedDO0PulseWidth))]
+    [XmlInclude(typeof(TimestampedDetectionLogConfig))]
+    [XmlInclude(typeof(TimestampedDetectionLogPending))]
+    [XmlInclude(typeof(TimestampedDetectionLogRecords))]
+    [XmlInclude(typeof(TimestampedDetectionLogAck))]
+    [XmlInclude(typeof(TimestampedConfigImage))]
+    [XmlInclude(typeof(TimestampedMatchTable))]
+    [XmlInclude(typeof(TimestampedRawFrameConfig))]
+    [XmlInclude(typeof(TimestampedRawFrame))]
+    [XmlInclude(typeof(TimestampedReaderProtocols))]
+    [XmlInclude(typeof(TimestampedReaderInterface))]
+    [XmlInclude(typeof(TimestampedTagIdAntenna))]
+    [XmlInclude(typeof(TimestampedEventConfig))]
+    [XmlInclude(typeof(TimestampedInboundMatchIndex))]
+    [XmlInclude(typeof(TimestampedOutboundMatchIndex))]
+    [XmlInclude(typeof(TimestampedUnmatchedDetectionId))]
+    [XmlInclude(typeof(TimestampedStatisticsConfig))]
+    [XmlInclude(typeof(TimestampedStatistics))]
+    [XmlInclude(typeof(TimestampedPresenceQuality))]
+    [XmlInclude(typeof(TimestampedLatencyHistogram))]
+    [XmlInclude(typeof(TimestampedRules))]
+    [XmlInclude(typeof(TimestampedSuppressedActivations))]
+    [XmlInclude(typeof(TimestampedTagPresent))]
+    [XmlInclude(typeof(TimestampedTagPresentPulseWidth))]
+    [XmlInclude(typeof(TimestampedTagPresentNotifications))]
+    [XmlInclude(typeof(TimestampedOut0Gate))]
+    [XmlInclude(typeof(TimestampedOut0GateMinimumPulse))]
+    [XmlInclude(typeof(TimestampedOut0GateHoldOff))]
+    [XmlInclude(typeof(TimestampedTagInRangeFilter))]
+    [XmlInclude(typeof(TimestampedTagInRangeGlitches))]
+    [XmlInclude(typeof(TimestampedWorkQueue))]
+    [XmlInclude(typeof(TimestampedSelfTest))]
+    [XmlInclude(typeof(TimestampedSelfTestResult))]
+    [XmlInclude(typeof(TimestampedReaderBaudRate))]
+    [XmlInclude(typeof(TimestampedFrameTiming))]
+    [XmlInclude(typeof(TimestampedUserPattern))]
+    [XmlInclude(typeof(TimestampedStackFree))]
+    [XmlInclude(typeof(TimestampedHandlerTimes))]
     [Description("Filters and selects specific messages reported by the RfidReader device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -251,6 +473,43 @@ namespace Harp.RfidReader
     /// <seealso cref="MatchTagId3PulseWidth"/>
     /// <seealso cref="AnyTagIdPulseWidth"/>
     /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DetectionLogConfig"/>
+    /// <seealso cref="DetectionLogPending"/>
+    /// <seealso cref="DetectionLogRecords"/>
+    /// <seealso cref="DetectionLogAck"/>
+    /// <seealso cref="ConfigImage"/>
+    /// <seealso cref="MatchTable"/>
+    /// <seealso cref="RawFrameConfig"/>
+    /// <seealso cref="RawFrame"/>
+    /// <seealso cref="ReaderProtocols"/>
+    /// <seealso cref="ReaderInterface"/>
+    /// <seealso cref="TagIdAntenna"/>
+    /// <seealso cref="EventConfig"/>
+    /// <seealso cref="InboundMatchIndex"/>
+    /// <seealso cref="OutboundMatchIndex"/>
+    /// <seealso cref="UnmatchedDetectionId"/>
+    /// <seealso cref="StatisticsConfig"/>
+    /// <seealso cref="Statistics"/>
+    /// <seealso cref="PresenceQuality"/>
+    /// <seealso cref="LatencyHistogram"/>
+    /// <seealso cref="Rules"/>
+    /// <seealso cref="SuppressedActivations"/>
+    /// <seealso cref="TagPresent"/>
+    /// <seealso cref="TagPresentPulseWidth"/>
+    /// <seealso cref="TagPresentNotifications"/>
+    /// <seealso cref="Out0Gate"/>
+    /// <seealso cref="Out0GateMinimumPulse"/>
+    /// <seealso cref="Out0GateHoldOff"/>
+    /// <seealso cref="TagInRangeFilter"/>
+    /// <seealso cref="TagInRangeGlitches"/>
+    /// <seealso cref="WorkQueue"/>
+    /// <seealso cref="SelfTest"/>
+    /// <seealso cref="SelfTestResult"/>
+    /// <seealso cref="ReaderBaudRate"/>
+    /// <seealso cref="FrameTiming"/>
+    /// <seealso cref="UserPattern"/>
+    /// <seealso cref="StackFree"/>
+    /// <seealso cref="HandlerTimes"/>
     [XmlInclude(typeof(InboundDetectionId))]
     [XmlInclude(typeof(OutboundDetectionId))]
     [XmlInclude(typeof(DO0State))]
@@ -272,6 +531,43 @@ namespace Harp.RfidReader
     [XmlInclude(typeof(MatchTagId3PulseWidth))]
     [XmlInclude(typeof(AnyTagIdPulseWidth))]
     [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DetectionLogConfig))]
+    [XmlInclude(typeof(DetectionLogPending))]
+    [XmlInclude(typeof(DetectionLogRecords))]
+    [XmlInclude(typeof(DetectionLogAck))]
+    [XmlInclude(typeof(ConfigImage))]
+    [XmlInclude(typeof(MatchTable))]
+    [XmlInclude(typeof(RawFrameConfig))]
+    [XmlInclude(typeof(RawFrame))]
+    [XmlInclude(typeof(ReaderProtocols))]
+    [XmlInclude(typeof(ReaderInterface))]
+    [XmlInclude(typeof(TagIdAntenna))]
+    [XmlInclude(typeof(EventConfig))]
+    [XmlInclude(typeof(InboundMatchIndex))]
+    [XmlInclude(typeof(OutboundMatchIndex))]
+    [XmlInclude(typeof(UnmatchedDetectionId))]
+    [XmlInclude(typeof(StatisticsConfig))]
+    [XmlInclude(typeof(Statistics))]
+    [XmlInclude(typeof(PresenceQuality))]
+    [XmlInclude(typeof(LatencyHistogram))]
+    [XmlInclude(typeof(Rules))]
+    [XmlInclude(typeof(SuppressedActivations))]
+    [XmlInclude(typeof(TagPresent))]
+    [XmlInclude(typeof(TagPresentPulseWidth))]
+    [XmlInclude(typeof(TagPresentNotifications))]
+    [XmlInclude(typeof(Out0Gate))]
+    [XmlInclude(typeof(Out0GateMinimumPulse))]
+    [XmlInclude(typeof(Out0GateHoldOff))]
+    [XmlInclude(typeof(TagInRangeFilter))]
+    [XmlInclude(typeof(TagInRangeGlitches))]
+    [XmlInclude(typeof(WorkQueue))]
+    [XmlInclude(typeof(SelfTest))]
+    [XmlInclude(typeof(SelfTestResult))]
+    [XmlInclude(typeof(ReaderBaudRate))]
+    [XmlInclude(typeof(FrameTiming))]
+    [XmlInclude(typeof(UserPattern))]
+    [XmlInclude(typeof(StackFree))]
+    [XmlInclude(typeof(HandlerTimes))]
     [Description("Formats a sequence of values as specific RfidReader register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -2305,1235 +2601,6909 @@ namespace Harp.RfidReader
         }
     }
 
+    /// <summary>
+    /// Represents a register that configures the detection log kept on the EEPROM.
+    /// </summary>
+    [Description("Configures the detection log kept on the EEPROM.")]
+    public partial class DetectionLogConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DetectionLogConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DetectionLogConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DetectionLogConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DetectionLogOptions GetPayload(HarpMessage message)
+        {
+            return (DetectionLogOptions)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DetectionLogConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DetectionLogOptions> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DetectionLogOptions)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DetectionLogConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DetectionLogOptions value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DetectionLogConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DetectionLogOptions value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DetectionLogConfig register.
+    /// </summary>
+    /// <seealso cref="DetectionLogConfig"/>
+    [Description("Filters and selects timestamped messages from the DetectionLogConfig register.")]
+    public partial class TimestampedDetectionLogConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DetectionLogConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DetectionLogConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DetectionLogOptions> GetPayload(HarpMessage message)
+        {
+            return DetectionLogConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the number of logged detection events not yet acknowledged by the host.
+    /// </summary>
+    [Description("The number of logged detection events not yet acknowledged by the host.")]
+    public partial class DetectionLogPending
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogPending"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DetectionLogPending"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DetectionLogPending"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DetectionLogPending"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DetectionLogPending"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DetectionLogPending"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogPending"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DetectionLogPending"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogPending"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DetectionLogPending register.
+    /// </summary>
+    /// <seealso cref="DetectionLogPending"/>
+    [Description("Filters and selects timestamped messages from the DetectionLogPending register.")]
+    public partial class TimestampedDetectionLogPending
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogPending"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DetectionLogPending.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DetectionLogPending"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DetectionLogPending.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.
+    /// </summary>
+    [Description("The 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.")]
+    public partial class DetectionLogRecords
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogRecords"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DetectionLogRecords"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DetectionLogRecords"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DetectionLogRecords"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DetectionLogRecords"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DetectionLogRecords"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogRecords"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DetectionLogRecords"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogRecords"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DetectionLogRecords register.
+    /// </summary>
+    /// <seealso cref="DetectionLogRecords"/>
+    [Description("Filters and selects timestamped messages from the DetectionLogRecords register.")]
+    public partial class TimestampedDetectionLogRecords
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogRecords"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DetectionLogRecords.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DetectionLogRecords"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return DetectionLogRecords.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.
+    /// </summary>
+    [Description("Acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.")]
+    public partial class DetectionLogAck
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogAck"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DetectionLogAck"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DetectionLogAck"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DetectionLogAck"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DetectionLogAck"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DetectionLogAck"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogAck"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DetectionLogAck"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DetectionLogAck"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DetectionLogAck register.
+    /// </summary>
+    /// <seealso cref="DetectionLogAck"/>
+    [Description("Filters and selects timestamped messages from the DetectionLogAck register.")]
+    public partial class TimestampedDetectionLogAck
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DetectionLogAck"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DetectionLogAck.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DetectionLogAck"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DetectionLogAck.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.
+    /// </summary>
+    [Description("Saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.")]
+    public partial class ConfigImage
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigImage"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ConfigImage"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ConfigImage"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ConfigImage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ConfigImageCommands GetPayload(HarpMessage message)
+        {
+            return (ConfigImageCommands)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ConfigImage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ConfigImageCommands> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ConfigImageCommands)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ConfigImage"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigImage"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ConfigImageCommands value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ConfigImage"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigImage"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ConfigImageCommands value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ConfigImage register.
+    /// </summary>
+    /// <seealso cref="ConfigImage"/>
+    [Description("Filters and selects timestamped messages from the ConfigImage register.")]
+    public partial class TimestampedConfigImage
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigImage"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ConfigImage.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ConfigImage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ConfigImageCommands> GetPayload(HarpMessage message)
+        {
+            return ConfigImage.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.
+    /// </summary>
+    [Description("Match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.")]
+    public partial class MatchTable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MatchTable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MatchTable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MatchTable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MatchTable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MatchTable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MatchTable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MatchTable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MatchTable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MatchTable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MatchTable register.
+    /// </summary>
+    /// <seealso cref="MatchTable"/>
+    [Description("Filters and selects timestamped messages from the MatchTable register.")]
+    public partial class TimestampedMatchTable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MatchTable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MatchTable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MatchTable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return MatchTable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures which frames received from the reader module are published on RawFrame.
+    /// </summary>
+    [Description("Configures which frames received from the reader module are published on RawFrame.")]
+    public partial class RawFrameConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RawFrameConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RawFrameConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RawFrameConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RawFrameConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static RawFrameOptions GetPayload(HarpMessage message)
+        {
+            return (RawFrameOptions)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RawFrameConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<RawFrameOptions> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((RawFrameOptions)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RawFrameConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RawFrameConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, RawFrameOptions value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RawFrameConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RawFrameConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, RawFrameOptions value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RawFrameConfig register.
+    /// </summary>
+    /// <seealso cref="RawFrameConfig"/>
+    [Description("Filters and selects timestamped messages from the RawFrameConfig register.")]
+    public partial class TimestampedRawFrameConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RawFrameConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RawFrameConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RawFrameConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<RawFrameOptions> GetPayload(HarpMessage message)
+        {
+            return RawFrameConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.
+    /// </summary>
+    [Description("The length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.")]
+    public partial class RawFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RawFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="RawFrame"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="RawFrame"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 31;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="RawFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="RawFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="RawFrame"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RawFrame"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="RawFrame"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="RawFrame"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// RawFrame register.
+    /// </summary>
+    /// <seealso cref="RawFrame"/>
+    [Description("Filters and selects timestamped messages from the RawFrame register.")]
+    public partial class TimestampedRawFrame
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="RawFrame"/> register. This field is constant.
+        /// </summary>
+        public const int Address = RawFrame.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="RawFrame"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return RawFrame.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables the frame formats decoded from the reader module.
+    /// </summary>
+    [Description("Enables the frame formats decoded from the reader module.")]
+    public partial class ReaderProtocols
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ReaderProtocols"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ReaderProtocols"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ReaderProtocols"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ReaderProtocols"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TagProtocols GetPayload(HarpMessage message)
+        {
+            return (TagProtocols)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ReaderProtocols"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TagProtocols> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TagProtocols)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ReaderProtocols"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ReaderProtocols"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TagProtocols value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ReaderProtocols"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ReaderProtocols"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TagProtocols value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ReaderProtocols register.
+    /// </summary>
+    /// <seealso cref="ReaderProtocols"/>
+    [Description("Filters and selects timestamped messages from the ReaderProtocols register.")]
+    public partial class TimestampedReaderProtocols
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ReaderProtocols"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ReaderProtocols.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ReaderProtocols"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TagProtocols> GetPayload(HarpMessage message)
+        {
+            return ReaderProtocols.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the output of the reader module that is decoded.
+    /// </summary>
+    [Description("Selects the output of the reader module that is decoded.")]
+    public partial class ReaderInterface
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ReaderInterface"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ReaderInterface"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ReaderInterface"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ReaderInterface"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ReaderOutput GetPayload(HarpMessage message)
+        {
+            return (ReaderOutput)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ReaderInterface"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ReaderOutput> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ReaderOutput)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ReaderInterface"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ReaderInterface"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ReaderOutput value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ReaderInterface"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ReaderInterface"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ReaderOutput value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ReaderInterface register.
+    /// </summary>
+    /// <seealso cref="ReaderInterface"/>
+    [Description("Filters and selects timestamped messages from the ReaderInterface register.")]
+    public partial class TimestampedReaderInterface
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ReaderInterface"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ReaderInterface.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ReaderInterface"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ReaderOutput> GetPayload(HarpMessage message)
+        {
+            return ReaderInterface.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.
+    /// </summary>
+    [Description("The reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.")]
+    public partial class TagIdAntenna
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagIdAntenna"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TagIdAntenna"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TagIdAntenna"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TagIdAntenna"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TagIdAntenna"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TagIdAntenna"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagIdAntenna"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TagIdAntenna"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagIdAntenna"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TagIdAntenna register.
+    /// </summary>
+    /// <seealso cref="TagIdAntenna"/>
+    [Description("Filters and selects timestamped messages from the TagIdAntenna register.")]
+    public partial class TimestampedTagIdAntenna
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagIdAntenna"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TagIdAntenna.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TagIdAntenna"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return TagIdAntenna.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the compact detection events and the events of tags that don't match.
+    /// </summary>
+    [Description("Configures the compact detection events and the events of tags that don't match.")]
+    public partial class EventConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EventOptions GetPayload(HarpMessage message)
+        {
+            return (EventOptions)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EventOptions> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EventOptions)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EventOptions value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EventOptions value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventConfig register.
+    /// </summary>
+    /// <seealso cref="EventConfig"/>
+    [Description("Filters and selects timestamped messages from the EventConfig register.")]
+    public partial class TimestampedEventConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EventOptions> GetPayload(HarpMessage message)
+        {
+            return EventConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.
+    /// </summary>
+    [Description("The index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.")]
+    public partial class InboundMatchIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="InboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="InboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="InboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="InboundMatchIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="InboundMatchIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="InboundMatchIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="InboundMatchIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="InboundMatchIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="InboundMatchIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// InboundMatchIndex register.
+    /// </summary>
+    /// <seealso cref="InboundMatchIndex"/>
+    [Description("Filters and selects timestamped messages from the InboundMatchIndex register.")]
+    public partial class TimestampedInboundMatchIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="InboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = InboundMatchIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="InboundMatchIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return InboundMatchIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the index of the matching ID of the tag that exited the area of the reader.
+    /// </summary>
+    [Description("The index of the matching ID of the tag that exited the area of the reader.")]
+    public partial class OutboundMatchIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OutboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OutboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OutboundMatchIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OutboundMatchIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OutboundMatchIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutboundMatchIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OutboundMatchIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutboundMatchIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OutboundMatchIndex register.
+    /// </summary>
+    /// <seealso cref="OutboundMatchIndex"/>
+    [Description("Filters and selects timestamped messages from the OutboundMatchIndex register.")]
+    public partial class TimestampedOutboundMatchIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutboundMatchIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OutboundMatchIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OutboundMatchIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return OutboundMatchIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the ID of a detected tag that doesn't match any of the IDs to match.
+    /// </summary>
+    [Description("The ID of a detected tag that doesn't match any of the IDs to match.")]
+    public partial class UnmatchedDetectionId
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UnmatchedDetectionId"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="UnmatchedDetectionId"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U64;
+
+        /// <summary>
+        /// Represents the length of the <see cref="UnmatchedDetectionId"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="UnmatchedDetectionId"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ulong GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt64();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="UnmatchedDetectionId"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ulong> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt64();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="UnmatchedDetectionId"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UnmatchedDetectionId"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ulong value)
+        {
+            return HarpMessage.FromUInt64(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="UnmatchedDetectionId"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UnmatchedDetectionId"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ulong value)
+        {
+            return HarpMessage.FromUInt64(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// UnmatchedDetectionId register.
+    /// </summary>
+    /// <seealso cref="UnmatchedDetectionId"/>
+    [Description("Filters and selects timestamped messages from the UnmatchedDetectionId register.")]
+    public partial class TimestampedUnmatchedDetectionId
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UnmatchedDetectionId"/> register. This field is constant.
+        /// </summary>
+        public const int Address = UnmatchedDetectionId.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="UnmatchedDetectionId"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ulong> GetPayload(HarpMessage message)
+        {
+            return UnmatchedDetectionId.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables the statistics event sent each second.
+    /// </summary>
+    [Description("Enables the statistics event sent each second.")]
+    public partial class StatisticsConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StatisticsConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StatisticsConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StatisticsConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StatisticsConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StatisticsOptions GetPayload(HarpMessage message)
+        {
+            return (StatisticsOptions)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StatisticsConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StatisticsOptions> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((StatisticsOptions)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StatisticsConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StatisticsConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StatisticsOptions value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StatisticsConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StatisticsConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StatisticsOptions value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StatisticsConfig register.
+    /// </summary>
+    /// <seealso cref="StatisticsConfig"/>
+    [Description("Filters and selects timestamped messages from the StatisticsConfig register.")]
+    public partial class TimestampedStatisticsConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StatisticsConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StatisticsConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StatisticsConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StatisticsOptions> GetPayload(HarpMessage message)
+        {
+            return StatisticsConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.
+    /// </summary>
+    [Description("On the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.")]
+    public partial class Statistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Statistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Statistics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Statistics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Statistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Statistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Statistics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Statistics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Statistics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Statistics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Statistics register.
+    /// </summary>
+    /// <seealso cref="Statistics"/>
+    [Description("Filters and selects timestamped messages from the Statistics register.")]
+    public partial class TimestampedStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Statistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Statistics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Statistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Statistics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.
+    /// </summary>
+    [Description("Sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.")]
+    public partial class PresenceQuality
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresenceQuality"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PresenceQuality"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PresenceQuality"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PresenceQuality"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PresenceQuality"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PresenceQuality"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresenceQuality"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PresenceQuality"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PresenceQuality"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PresenceQuality register.
+    /// </summary>
+    /// <seealso cref="PresenceQuality"/>
+    [Description("Filters and selects timestamped messages from the PresenceQuality register.")]
+    public partial class TimestampedPresenceQuality
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PresenceQuality"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PresenceQuality.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PresenceQuality"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return PresenceQuality.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.
+    /// </summary>
+    [Description("Histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.")]
+    public partial class LatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 24;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyHistogram"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyHistogram"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyHistogram"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyHistogram"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyHistogram register.
+    /// </summary>
+    /// <seealso cref="LatencyHistogram"/>
+    [Description("Filters and selects timestamped messages from the LatencyHistogram register.")]
+    public partial class TimestampedLatencyHistogram
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyHistogram"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyHistogram.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyHistogram"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return LatencyHistogram.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.
+    /// </summary>
+    [Description("3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.")]
+    public partial class Rules
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Rules"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Rules"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Rules"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 39;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Rules"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Rules"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Rules"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Rules"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Rules"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Rules"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Rules register.
+    /// </summary>
+    /// <seealso cref="Rules"/>
+    [Description("Filters and selects timestamped messages from the Rules register.")]
+    public partial class TimestampedRules
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Rules"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Rules.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Rules"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return Rules.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.
+    /// </summary>
+    [Description("Activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.")]
+    public partial class SuppressedActivations
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SuppressedActivations"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SuppressedActivations"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SuppressedActivations"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SuppressedActivations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SuppressedActivations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SuppressedActivations"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SuppressedActivations"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SuppressedActivations"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SuppressedActivations"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SuppressedActivations register.
+    /// </summary>
+    /// <seealso cref="SuppressedActivations"/>
+    [Description("Filters and selects timestamped messages from the SuppressedActivations register.")]
+    public partial class TimestampedSuppressedActivations
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SuppressedActivations"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SuppressedActivations.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SuppressedActivations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SuppressedActivations.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.
+    /// </summary>
+    [Description("Sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.")]
+    public partial class TagPresent
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagPresent"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TagPresent"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TagPresent"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TagPresent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TagPresent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TagPresent"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagPresent"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TagPresent"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagPresent"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TagPresent register.
+    /// </summary>
+    /// <seealso cref="TagPresent"/>
+    [Description("Filters and selects timestamped messages from the TagPresent register.")]
+    public partial class TimestampedTagPresent
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagPresent"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TagPresent.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TagPresent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return TagPresent.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.
+    /// </summary>
+    [Description("Pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.")]
+    public partial class TagPresentPulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagPresentPulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TagPresentPulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TagPresentPulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TagPresentPulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TagPresentPulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TagPresentPulseWidth"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagPresentPulseWidth"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TagPresentPulseWidth"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagPresentPulseWidth"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TagPresentPulseWidth register.
+    /// </summary>
+    /// <seealso cref="TagPresentPulseWidth"/>
+    [Description("Filters and selects timestamped messages from the TagPresentPulseWidth register.")]
+    public partial class TimestampedTagPresentPulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagPresentPulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TagPresentPulseWidth.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TagPresentPulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return TagPresentPulseWidth.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that hardware notifications triggered on the rising edge of TAG_IN_RANGE.
+    /// </summary>
+    [Description("Hardware notifications triggered on the rising edge of TAG_IN_RANGE.")]
+    public partial class TagPresentNotifications
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagPresentNotifications"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TagPresentNotifications"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TagPresentNotifications"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TagPresentNotifications"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static HardwareNotifications GetPayload(HarpMessage message)
+        {
+            return (HardwareNotifications)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TagPresentNotifications"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HardwareNotifications> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((HardwareNotifications)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TagPresentNotifications"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagPresentNotifications"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, HardwareNotifications value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TagPresentNotifications"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagPresentNotifications"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, HardwareNotifications value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TagPresentNotifications register.
+    /// </summary>
+    /// <seealso cref="TagPresentNotifications"/>
+    [Description("Filters and selects timestamped messages from the TagPresentNotifications register.")]
+    public partial class TimestampedTagPresentNotifications
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagPresentNotifications"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TagPresentNotifications.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TagPresentNotifications"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<HardwareNotifications> GetPayload(HarpMessage message)
+        {
+            return TagPresentNotifications.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.
+    /// </summary>
+    [Description("Routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.")]
+    public partial class Out0Gate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Out0Gate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Out0Gate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Out0Gate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Out0Gate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Out0GateOptions GetPayload(HarpMessage message)
+        {
+            return (Out0GateOptions)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Out0Gate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Out0GateOptions> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Out0GateOptions)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Out0Gate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Out0Gate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Out0GateOptions value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Out0Gate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Out0Gate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Out0GateOptions value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Out0Gate register.
+    /// </summary>
+    /// <seealso cref="Out0Gate"/>
+    [Description("Filters and selects timestamped messages from the Out0Gate register.")]
+    public partial class TimestampedOut0Gate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Out0Gate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Out0Gate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Out0Gate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Out0GateOptions> GetPayload(HarpMessage message)
+        {
+            return Out0Gate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that minimum pulse width of the gated digital output, in ms.
+    /// </summary>
+    [Description("Minimum pulse width of the gated digital output, in ms.")]
+    public partial class Out0GateMinimumPulse
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Out0GateMinimumPulse"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Out0GateMinimumPulse"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Out0GateMinimumPulse"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Out0GateMinimumPulse"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Out0GateMinimumPulse"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Out0GateMinimumPulse"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Out0GateMinimumPulse"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Out0GateMinimumPulse"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Out0GateMinimumPulse"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Out0GateMinimumPulse register.
+    /// </summary>
+    /// <seealso cref="Out0GateMinimumPulse"/>
+    [Description("Filters and selects timestamped messages from the Out0GateMinimumPulse register.")]
+    public partial class TimestampedOut0GateMinimumPulse
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Out0GateMinimumPulse"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Out0GateMinimumPulse.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Out0GateMinimumPulse"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Out0GateMinimumPulse.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.
+    /// </summary>
+    [Description("Time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.")]
+    public partial class Out0GateHoldOff
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Out0GateHoldOff"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Out0GateHoldOff"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Out0GateHoldOff"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Out0GateHoldOff"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Out0GateHoldOff"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Out0GateHoldOff"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Out0GateHoldOff"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Out0GateHoldOff"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Out0GateHoldOff"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Out0GateHoldOff register.
+    /// </summary>
+    /// <seealso cref="Out0GateHoldOff"/>
+    [Description("Filters and selects timestamped messages from the Out0GateHoldOff register.")]
+    public partial class TimestampedOut0GateHoldOff
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Out0GateHoldOff"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Out0GateHoldOff.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Out0GateHoldOff"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Out0GateHoldOff.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.
+    /// </summary>
+    [Description("Minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.")]
+    public partial class TagInRangeFilter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagInRangeFilter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TagInRangeFilter"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TagInRangeFilter"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TagInRangeFilter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TagInRangeFilter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TagInRangeFilter"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagInRangeFilter"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TagInRangeFilter"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagInRangeFilter"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TagInRangeFilter register.
+    /// </summary>
+    /// <seealso cref="TagInRangeFilter"/>
+    [Description("Filters and selects timestamped messages from the TagInRangeFilter register.")]
+    public partial class TimestampedTagInRangeFilter
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagInRangeFilter"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TagInRangeFilter.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TagInRangeFilter"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return TagInRangeFilter.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.
+    /// </summary>
+    [Description("Transitions of TAG_IN_RANGE filtered out. Any write resets the counter.")]
+    public partial class TagInRangeGlitches
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagInRangeGlitches"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TagInRangeGlitches"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TagInRangeGlitches"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TagInRangeGlitches"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TagInRangeGlitches"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TagInRangeGlitches"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagInRangeGlitches"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TagInRangeGlitches"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TagInRangeGlitches"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TagInRangeGlitches register.
+    /// </summary>
+    /// <seealso cref="TagInRangeGlitches"/>
+    [Description("Filters and selects timestamped messages from the TagInRangeGlitches register.")]
+    public partial class TimestampedTagInRangeGlitches
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TagInRangeGlitches"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TagInRangeGlitches.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TagInRangeGlitches"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return TagInRangeGlitches.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.
+    /// </summary>
+    [Description("Frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.")]
+    public partial class WorkQueue
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WorkQueue"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="WorkQueue"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="WorkQueue"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="WorkQueue"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="WorkQueue"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="WorkQueue"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WorkQueue"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="WorkQueue"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WorkQueue"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// WorkQueue register.
+    /// </summary>
+    /// <seealso cref="WorkQueue"/>
+    [Description("Filters and selects timestamped messages from the WorkQueue register.")]
+    public partial class TimestampedWorkQueue
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WorkQueue"/> register. This field is constant.
+        /// </summary>
+        public const int Address = WorkQueue.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="WorkQueue"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return WorkQueue.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.
+    /// </summary>
+    [Description("Starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.")]
+    public partial class SelfTest
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SelfTest"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SelfTest"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SelfTest"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SelfTest"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TagProtocols GetPayload(HarpMessage message)
+        {
+            return (TagProtocols)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SelfTest"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TagProtocols> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TagProtocols)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SelfTest"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SelfTest"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TagProtocols value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SelfTest"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SelfTest"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TagProtocols value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SelfTest register.
+    /// </summary>
+    /// <seealso cref="SelfTest"/>
+    [Description("Filters and selects timestamped messages from the SelfTest register.")]
+    public partial class TimestampedSelfTest
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SelfTest"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SelfTest.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SelfTest"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TagProtocols> GetPayload(HarpMessage message)
+        {
+            return SelfTest.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.
+    /// </summary>
+    [Description("Self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.")]
+    public partial class SelfTestResult
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SelfTestResult"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SelfTestResult"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SelfTestResult"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SelfTestResult"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SelfTestResult"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SelfTestResult"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SelfTestResult"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SelfTestResult"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SelfTestResult"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SelfTestResult register.
+    /// </summary>
+    /// <seealso cref="SelfTestResult"/>
+    [Description("Filters and selects timestamped messages from the SelfTestResult register.")]
+    public partial class TimestampedSelfTestResult
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SelfTestResult"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SelfTestResult.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SelfTestResult"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SelfTestResult.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.
+    /// </summary>
+    [Description("Baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.")]
+    public partial class ReaderBaudRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ReaderBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ReaderBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ReaderBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ReaderBaudRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static BaudRate GetPayload(HarpMessage message)
+        {
+            return (BaudRate)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ReaderBaudRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BaudRate> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((BaudRate)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ReaderBaudRate"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ReaderBaudRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, BaudRate value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ReaderBaudRate"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ReaderBaudRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, BaudRate value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ReaderBaudRate register.
+    /// </summary>
+    /// <seealso cref="ReaderBaudRate"/>
+    [Description("Filters and selects timestamped messages from the ReaderBaudRate register.")]
+    public partial class TimestampedReaderBaudRate
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ReaderBaudRate"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ReaderBaudRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ReaderBaudRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<BaudRate> GetPayload(HarpMessage message)
+        {
+            return ReaderBaudRate.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.
+    /// </summary>
+    [Description("Learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.")]
+    public partial class FrameTiming
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameTiming"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FrameTiming"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FrameTiming"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FrameTiming"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FrameTiming"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FrameTiming"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameTiming"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FrameTiming"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FrameTiming"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FrameTiming register.
+    /// </summary>
+    /// <seealso cref="FrameTiming"/>
+    [Description("Filters and selects timestamped messages from the FrameTiming register.")]
+    public partial class TimestampedFrameTiming
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FrameTiming"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FrameTiming.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FrameTiming"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return FrameTiming.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.
+    /// </summary>
+    [Description("The user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.")]
+    public partial class UserPattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UserPattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="UserPattern"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="UserPattern"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="UserPattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="UserPattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="UserPattern"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UserPattern"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="UserPattern"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="UserPattern"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// UserPattern register.
+    /// </summary>
+    /// <seealso cref="UserPattern"/>
+    [Description("Filters and selects timestamped messages from the UserPattern register.")]
+    public partial class TimestampedUserPattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="UserPattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = UserPattern.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="UserPattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return UserPattern.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.
+    /// </summary>
+    [Description("The bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.")]
+    public partial class StackFree
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StackFree"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StackFree"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StackFree"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StackFree"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StackFree"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StackFree"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StackFree register.
+    /// </summary>
+    /// <seealso cref="StackFree"/>
+    [Description("Filters and selects timestamped messages from the StackFree register.")]
+    public partial class TimestampedStackFree
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StackFree.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StackFree"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StackFree.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.
+    /// </summary>
+    [Description("The longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.")]
+    public partial class HandlerTimes
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HandlerTimes"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="HandlerTimes"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="HandlerTimes"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="HandlerTimes"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="HandlerTimes"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="HandlerTimes"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HandlerTimes"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="HandlerTimes"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="HandlerTimes"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// HandlerTimes register.
+    /// </summary>
+    /// <seealso cref="HandlerTimes"/>
+    [Description("Filters and selects timestamped messages from the HandlerTimes register.")]
+    public partial class TimestampedHandlerTimes
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="HandlerTimes"/> register. This field is constant.
+        /// </summary>
+        public const int Address = HandlerTimes.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="HandlerTimes"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return HandlerTimes.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// RfidReader device.
     /// </summary>
-    /// <seealso cref="CreateInboundDetectionIdPayload"/>
-    /// <seealso cref="CreateOutboundDetectionIdPayload"/>
-    /// <seealso cref="CreateDO0StatePayload"/>
-    /// <seealso cref="CreateHardwareNotificationsStatePayload"/>
-    /// <seealso cref="CreateHardwareNotificationsTriggerPayload"/>
-    /// <seealso cref="CreateBuzzerDurationPayload"/>
-    /// <seealso cref="CreateTopLedDurationPayload"/>
-    /// <seealso cref="CreateBottomLedDurationPayload"/>
-    /// <seealso cref="CreateBuzzerFrequencyPayload"/>
-    /// <seealso cref="CreateTopLedPeriodPayload"/>
-    /// <seealso cref="CreateBottomLedPeriodPayload"/>
-    /// <seealso cref="CreateMatchTagId0Payload"/>
-    /// <seealso cref="CreateMatchTagId1Payload"/>
-    /// <seealso cref="CreateMatchTagId2Payload"/>
-    /// <seealso cref="CreateMatchTagId3Payload"/>
-    /// <seealso cref="CreateMatchTagId0PulseWidthPayload"/>
-    /// <seealso cref="CreateMatchTagId1PulseWidthPayload"/>
-    /// <seealso cref="CreateMatchTagId2PulseWidthPayload"/>
-    /// <seealso cref="CreateMatchTagId3PulseWidthPayload"/>
-    /// <seealso cref="CreateAnyTagIdPulseWidthPayload"/>
-    /// <seealso cref="CreateDO0PulseWidthPayload"/>
-    [XmlInclude(typeof(CreateInboundDetectionIdPayload))]
-    [XmlInclude(typeof(CreateOutboundDetectionIdPayload))]
-    [XmlInclude(typeof(CreateDO0StatePayload))]
-    [XmlInclude(typeof(CreateHardwareNotificationsStatePayload))]
-    [XmlInclude(typeof(CreateHardwareNotificationsTriggerPayload))]
-    [XmlInclude(typeof(CreateBuzzerDurationPayload))]
-    [XmlInclude(typeof(CreateTopLedDurationPayload))]
-    [XmlInclude(typeof(CreateBottomLedDurationPayload))]
-    [XmlInclude(typeof(CreateBuzzerFrequencyPayload))]
-    [XmlInclude(typeof(CreateTopLedPeriodPayload))]
-    [XmlInclude(typeof(CreateBottomLedPeriodPayload))]
-    [XmlInclude(typeof(CreateMatchTagId0Payload))]
-    [XmlInclude(typeof(CreateMatchTagId1Payload))]
-    [XmlInclude(typeof(CreateMatchTagId2Payload))]
-    [XmlInclude(typeof(CreateMatchTagId3Payload))]
-    [XmlInclude(typeof(CreateMatchTagId0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateMatchTagId1PulseWidthPayload))]
-    [XmlInclude(typeof(CreateMatchTagId2PulseWidthPayload))]
-    [XmlInclude(typeof(CreateMatchTagId3PulseWidthPayload))]
-    [XmlInclude(typeof(CreateAnyTagIdPulseWidthPayload))]
-    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedInboundDetectionIdPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutboundDetectionIdPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0StatePayload))]
-    [XmlInclude(typeof(CreateTimestampedHardwareNotificationsStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedHardwareNotificationsTriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedBuzzerDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedTopLedDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedBottomLedDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedBuzzerFrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedTopLedPeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedBottomLedPeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId0Payload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId1Payload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId2Payload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId3Payload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId1PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId2PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedMatchTagId3PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedAnyTagIdPulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
-    [Description("Creates standard message payloads for the RfidReader device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateInboundDetectionIdPayload"/>
+    /// <seealso cref="CreateOutboundDetectionIdPayload"/>
+    /// <seealso cref="CreateDO0StatePayload"/>
+    /// <seealso cref="CreateHardwareNotificationsStatePayload"/>
+    /// <seealso cref="CreateHardwareNotificationsTriggerPayload"/>
+    /// <seealso cref="CreateBuzzerDurationPayload"/>
+    /// <seealso cref="CreateTopLedDurationPayload"/>
+    /// <seealso cref="CreateBottomLedDurationPayload"/>
+    /// <seealso cref="CreateBuzzerFrequencyPayload"/>
+    /// <seealso cref="CreateTopLedPeriodPayload"/>
+    /// <seealso cref="CreateBottomLedPeriodPayload"/>
+    /// <seealso cref="CreateMatchTagId0Payload"/>
+    /// <seealso cref="CreateMatchTagId1Payload"/>
+    /// <seealso cref="CreateMatchTagId2Payload"/>
+    /// <seealso cref="CreateMatchTagId3Payload"/>
+    /// <seealso cref="CreateMatchTagId0PulseWidthPayload"/>
+    /// <seealso cref="CreateMatchTagId1PulseWidthPayload"/>
+    /// <seealso cref="CreateMatchTagId2PulseWidthPayload"/>
+    /// <seealso cref="CreateMatchTagId3PulseWidthPayload"/>
+    /// <seealso cref="CreateAnyTagIdPulseWidthPayload"/>
+    /// <seealso cref="CreateDO0PulseWidthPayload"/>
+    /// <seealso cref="CreateDetectionLogConfigPayload"/>
+    /// <seealso cref="CreateDetectionLogPendingPayload"/>
+    /// <seealso cref="CreateDetectionLogRecordsPayload"/>
+    /// <seealso cref="CreateDetectionLogAckPayload"/>
+    /// <seealso cref="CreateConfigImagePayload"/>
+    /// <seealso cref="CreateMatchTablePayload"/>
+    /// <seealso cref="CreateRawFrameConfigPayload"/>
+    /// <seealso cref="CreateRawFramePayload"/>
+    /// <seealso cref="CreateReaderProtocolsPayload"/>
+    /// <seealso cref="CreateReaderInterfacePayload"/>
+    /// <seealso cref="CreateTagIdAntennaPayload"/>
+    /// <seealso cref="CreateEventConfigPayload"/>
+    /// <seealso cref="CreateInboundMatchIndexPayload"/>
+    /// <seealso cref="CreateOutboundMatchIndexPayload"/>
+    /// <seealso cref="CreateUnmatchedDetectionIdPayload"/>
+    /// <seealso cref="CreateStatisticsConfigPayload"/>
+    /// <seealso cref="CreateStatisticsPayload"/>
+    /// <seealso cref="CreatePresenceQualityPayload"/>
+    /// <seealso cref="CreateLatencyHistogramPayload"/>
+    /// <seealso cref="CreateRulesPayload"/>
+    /// <seealso cref="CreateSuppressedActivationsPayload"/>
+    /// <seealso cref="CreateTagPresentPayload"/>
+    /// <seealso cref="CreateTagPresentPulseWidthPayload"/>
+    /// <seealso cref="CreateTagPresentNotificationsPayload"/>
+    /// <seealso cref="CreateOut0GatePayload"/>
+    /// <seealso cref="CreateOut0GateMinimumPulsePayload"/>
+    /// <seealso cref="CreateOut0GateHoldOffPayload"/>
+    /// <seealso cref="CreateTagInRangeFilterPayload"/>
+    /// <seealso cref="CreateTagInRangeGlitchesPayload"/>
+    /// <seealso cref="CreateWorkQueuePayload"/>
+    /// <seealso cref="CreateSelfTestPayload"/>
+    /// <seealso cref="CreateSelfTestResultPayload"/>
+    /// <seealso cref="CreateReaderBaudRatePayload"/>
+    /// <seealso cref="CreateFrameTimingPayload"/>
+    /// <seealso cref="CreateUserPatternPayload"/>
+    /// <seealso cref="CreateStackFreePayload"/>
+    /// <seealso cref="CreateHandlerTimesPayload"/>
+    [XmlInclude(typeof(CreateInboundDetectionIdPayload))]
+    [XmlInclude(typeof(CreateOutboundDetectionIdPayload))]
+    [XmlInclude(typeof(CreateDO0StatePayload))]
+    [XmlInclude(typeof(CreateHardwareNotificationsStatePayload))]
+    [XmlInclude(typeof(CreateHardwareNotificationsTriggerPayload))]
+    [XmlInclude(typeof(CreateBuzzerDurationPayload))]
+    [XmlInclude(typeof(CreateTopLedDurationPayload))]
+    [XmlInclude(typeof(CreateBottomLedDurationPayload))]
+    [XmlInclude(typeof(CreateBuzzerFrequencyPayload))]
+    [XmlInclude(typeof(CreateTopLedPeriodPayload))]
+    [XmlInclude(typeof(CreateBottomLedPeriodPayload))]
+    [XmlInclude(typeof(CreateMatchTagId0Payload))]
+    [XmlInclude(typeof(CreateMatchTagId1Payload))]
+    [XmlInclude(typeof(CreateMatchTagId2Payload))]
+    [XmlInclude(typeof(CreateMatchTagId3Payload))]
+    [XmlInclude(typeof(CreateMatchTagId0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateMatchTagId1PulseWidthPayload))]
+    [XmlInclude(typeof(CreateMatchTagId2PulseWidthPayload))]
+    [XmlInclude(typeof(CreateMatchTagId3PulseWidthPayload))]
+    [XmlInclude(typeof(CreateAnyTagIdPulseWidthPayload))]
+    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateDetectionLogConfigPayload))]
+    [XmlInclude(typeof(CreateDetectionLogPendingPayload))]
+    [XmlInclude(typeof(CreateDetectionLogRecordsPayload))]
+    [XmlInclude(typeof(CreateDetectionLogAckPayload))]
+    [XmlInclude(typeof(CreateConfigImagePayload))]
+    [XmlInclude(typeof(CreateMatchTablePayload))]
+    [XmlInclude(typeof(CreateRawFrameConfigPayload))]
+    [XmlInclude(typeof(CreateRawFramePayload))]
+    [XmlInclude(typeof(CreateReaderProtocolsPayload))]
+    [XmlInclude(typeof(CreateReaderInterfacePayload))]
+    [XmlInclude(typeof(CreateTagIdAntennaPayload))]
+    [XmlInclude(typeof(CreateEventConfigPayload))]
+    [XmlInclude(typeof(CreateInboundMatchIndexPayload))]
+    [XmlInclude(typeof(CreateOutboundMatchIndexPayload))]
+    [XmlInclude(typeof(CreateUnmatchedDetectionIdPayload))]
+    [XmlInclude(typeof(CreateStatisticsConfigPayload))]
+    [XmlInclude(typeof(CreateStatisticsPayload))]
+    [XmlInclude(typeof(CreatePresenceQualityPayload))]
+    [XmlInclude(typeof(CreateLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateRulesPayload))]
+    [XmlInclude(typeof(CreateSuppressedActivationsPayload))]
+    [XmlInclude(typeof(CreateTagPresentPayload))]
+    [XmlInclude(typeof(CreateTagPresentPulseWidthPayload))]
+    [XmlInclude(typeof(CreateTagPresentNotificationsPayload))]
+    [XmlInclude(typeof(CreateOut0GatePayload))]
+    [XmlInclude(typeof(CreateOut0GateMinimumPulsePayload))]
+    [XmlInclude(typeof(CreateOut0GateHoldOffPayload))]
+    [XmlInclude(typeof(CreateTagInRangeFilterPayload))]
+    [XmlInclude(typeof(CreateTagInRangeGlitchesPayload))]
+    [XmlInclude(typeof(CreateWorkQueuePayload))]
+    [XmlInclude(typeof(CreateSelfTestPayload))]
+    [XmlInclude(typeof(CreateSelfTestResultPayload))]
+    [XmlInclude(typeof(CreateReaderBaudRatePayload))]
+    [XmlInclude(typeof(CreateFrameTimingPayload))]
+    [XmlInclude(typeof(CreateUserPatternPayload))]
+    [XmlInclude(typeof(CreateStackFreePayload))]
+    [XmlInclude(typeof(CreateHandlerTimesPayload))]
+    [XmlInclude(typeof(CreateTimestampedInboundDetectionIdPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutboundDetectionIdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0StatePayload))]
+    [XmlInclude(typeof(CreateTimestampedHardwareNotificationsStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedHardwareNotificationsTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedBuzzerDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedTopLedDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedBottomLedDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedBuzzerFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedTopLedPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedBottomLedPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId0Payload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId1Payload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId2Payload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId3Payload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId1PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId2PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTagId3PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnyTagIdPulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDetectionLogConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedDetectionLogPendingPayload))]
+    [XmlInclude(typeof(CreateTimestampedDetectionLogRecordsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDetectionLogAckPayload))]
+    [XmlInclude(typeof(CreateTimestampedConfigImagePayload))]
+    [XmlInclude(typeof(CreateTimestampedMatchTablePayload))]
+    [XmlInclude(typeof(CreateTimestampedRawFrameConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedRawFramePayload))]
+    [XmlInclude(typeof(CreateTimestampedReaderProtocolsPayload))]
+    [XmlInclude(typeof(CreateTimestampedReaderInterfacePayload))]
+    [XmlInclude(typeof(CreateTimestampedTagIdAntennaPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedInboundMatchIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutboundMatchIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedUnmatchedDetectionIdPayload))]
+    [XmlInclude(typeof(CreateTimestampedStatisticsConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedStatisticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedPresenceQualityPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyHistogramPayload))]
+    [XmlInclude(typeof(CreateTimestampedRulesPayload))]
+    [XmlInclude(typeof(CreateTimestampedSuppressedActivationsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTagPresentPayload))]
+    [XmlInclude(typeof(CreateTimestampedTagPresentPulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedTagPresentNotificationsPayload))]
+    [XmlInclude(typeof(CreateTimestampedOut0GatePayload))]
+    [XmlInclude(typeof(CreateTimestampedOut0GateMinimumPulsePayload))]
+    [XmlInclude(typeof(CreateTimestampedOut0GateHoldOffPayload))]
+    [XmlInclude(typeof(CreateTimestampedTagInRangeFilterPayload))]
+    [XmlInclude(typeof(CreateTimestampedTagInRangeGlitchesPayload))]
+    [XmlInclude(typeof(CreateTimestampedWorkQueuePayload))]
+    [XmlInclude(typeof(CreateTimestampedSelfTestPayload))]
+    [XmlInclude(typeof(CreateTimestampedSelfTestResultPayload))]
+    [XmlInclude(typeof(CreateTimestampedReaderBaudRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedFrameTimingPayload))]
+    [XmlInclude(typeof(CreateTimestampedUserPatternPayload))]
+    [XmlInclude(typeof(CreateTimestampedStackFreePayload))]
+    [XmlInclude(typeof(CreateTimestampedHandlerTimesPayload))]
+    [Description("Creates standard message payloads for the RfidReader device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateInboundDetectionIdPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(RfidReader)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the ID of the tag that was detected as having entered the area of the reader.
+    /// </summary>
+    [DisplayName("InboundDetectionIdPayload")]
+    [Description("Creates a message payload that the ID of the tag that was detected as having entered the area of the reader.")]
+    public partial class CreateInboundDetectionIdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the ID of the tag that was detected as having entered the area of the reader.
+        /// </summary>
+        [Description("The value that the ID of the tag that was detected as having entered the area of the reader.")]
+        public ulong InboundDetectionId { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the InboundDetectionId register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return InboundDetectionId;
+        }
+
+        /// <summary>
+        /// Creates a message that the ID of the tag that was detected as having entered the area of the reader.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the InboundDetectionId register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.InboundDetectionId.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the ID of the tag that was detected as having entered the area of the reader.
+    /// </summary>
+    [DisplayName("TimestampedInboundDetectionIdPayload")]
+    [Description("Creates a timestamped message payload that the ID of the tag that was detected as having entered the area of the reader.")]
+    public partial class CreateTimestampedInboundDetectionIdPayload : CreateInboundDetectionIdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the ID of the tag that was detected as having entered the area of the reader.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the InboundDetectionId register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.InboundDetectionId.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the ID of the tag that was detected as having exited the area of the reader.
+    /// </summary>
+    [DisplayName("OutboundDetectionIdPayload")]
+    [Description("Creates a message payload that the ID of the tag that was detected as having exited the area of the reader.")]
+    public partial class CreateOutboundDetectionIdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the ID of the tag that was detected as having exited the area of the reader.
+        /// </summary>
+        [Description("The value that the ID of the tag that was detected as having exited the area of the reader.")]
+        public ulong OutboundDetectionId { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutboundDetectionId register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return OutboundDetectionId;
+        }
+
+        /// <summary>
+        /// Creates a message that the ID of the tag that was detected as having exited the area of the reader.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutboundDetectionId register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.OutboundDetectionId.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the ID of the tag that was detected as having exited the area of the reader.
+    /// </summary>
+    [DisplayName("TimestampedOutboundDetectionIdPayload")]
+    [Description("Creates a timestamped message payload that the ID of the tag that was detected as having exited the area of the reader.")]
+    public partial class CreateTimestampedOutboundDetectionIdPayload : CreateOutboundDetectionIdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the ID of the tag that was detected as having exited the area of the reader.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutboundDetectionId register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.OutboundDetectionId.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that changes the state of the digital output pin.
+    /// </summary>
+    [DisplayName("DO0StatePayload")]
+    [Description("Creates a message payload that changes the state of the digital output pin.")]
+    public partial class CreateDO0StatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that changes the state of the digital output pin.
+        /// </summary>
+        [Description("The value that changes the state of the digital output pin.")]
+        public DigitalState DO0State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0State register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalState GetPayload()
+        {
+            return DO0State;
+        }
+
+        /// <summary>
+        /// Creates a message that changes the state of the digital output pin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0State register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.DO0State.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that changes the state of the digital output pin.
+    /// </summary>
+    [DisplayName("TimestampedDO0StatePayload")]
+    [Description("Creates a timestamped message payload that changes the state of the digital output pin.")]
+    public partial class CreateTimestampedDO0StatePayload : CreateDO0StatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that changes the state of the digital output pin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0State register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.DO0State.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables or disables hardware notifications.
+    /// </summary>
+    [DisplayName("HardwareNotificationsStatePayload")]
+    [Description("Creates a message payload that enables or disables hardware notifications.")]
+    public partial class CreateHardwareNotificationsStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables or disables hardware notifications.
+        /// </summary>
+        [Description("The value that enables or disables hardware notifications.")]
+        public HardwareNotifications HardwareNotificationsState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the HardwareNotificationsState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public HardwareNotifications GetPayload()
+        {
+            return HardwareNotificationsState;
+        }
+
+        /// <summary>
+        /// Creates a message that enables or disables hardware notifications.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HardwareNotificationsState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.HardwareNotificationsState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables or disables hardware notifications.
+    /// </summary>
+    [DisplayName("TimestampedHardwareNotificationsStatePayload")]
+    [Description("Creates a timestamped message payload that enables or disables hardware notifications.")]
+    public partial class CreateTimestampedHardwareNotificationsStatePayload : CreateHardwareNotificationsStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables or disables hardware notifications.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HardwareNotificationsState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.HardwareNotificationsState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that triggers hardware notifications.
+    /// </summary>
+    [DisplayName("HardwareNotificationsTriggerPayload")]
+    [Description("Creates a message payload that triggers hardware notifications.")]
+    public partial class CreateHardwareNotificationsTriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that triggers hardware notifications.
+        /// </summary>
+        [Description("The value that triggers hardware notifications.")]
+        public HardwareNotifications HardwareNotificationsTrigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the HardwareNotificationsTrigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public HardwareNotifications GetPayload()
+        {
+            return HardwareNotificationsTrigger;
+        }
+
+        /// <summary>
+        /// Creates a message that triggers hardware notifications.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the HardwareNotificationsTrigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.HardwareNotificationsTrigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that triggers hardware notifications.
+    /// </summary>
+    [DisplayName("TimestampedHardwareNotificationsTriggerPayload")]
+    [Description("Creates a timestamped message payload that triggers hardware notifications.")]
+    public partial class CreateTimestampedHardwareNotificationsTriggerPayload : CreateHardwareNotificationsTriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that triggers hardware notifications.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the HardwareNotificationsTrigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.HardwareNotificationsTrigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the buzzer will stay on (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("BuzzerDurationPayload")]
+    [Description("Creates a message payload that the time the buzzer will stay on (sensitive to multiples of 2).")]
+    public partial class CreateBuzzerDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the buzzer will stay on (sensitive to multiples of 2).
+        /// </summary>
+        [Range(min: 2, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the time the buzzer will stay on (sensitive to multiples of 2).")]
+        public ushort BuzzerDuration { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the BuzzerDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BuzzerDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the buzzer will stay on (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BuzzerDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.BuzzerDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the buzzer will stay on (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TimestampedBuzzerDurationPayload")]
+    [Description("Creates a timestamped message payload that the time the buzzer will stay on (sensitive to multiples of 2).")]
+    public partial class CreateTimestampedBuzzerDurationPayload : CreateBuzzerDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the buzzer will stay on (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BuzzerDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.BuzzerDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the top LED will stay on (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TopLedDurationPayload")]
+    [Description("Creates a message payload that the time the top LED will stay on (sensitive to multiples of 2).")]
+    public partial class CreateTopLedDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the top LED will stay on (sensitive to multiples of 2).
+        /// </summary>
+        [Range(min: 2, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the time the top LED will stay on (sensitive to multiples of 2).")]
+        public ushort TopLedDuration { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the TopLedDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return TopLedDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the top LED will stay on (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TopLedDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.TopLedDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the top LED will stay on (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TimestampedTopLedDurationPayload")]
+    [Description("Creates a timestamped message payload that the time the top LED will stay on (sensitive to multiples of 2).")]
+    public partial class CreateTimestampedTopLedDurationPayload : CreateTopLedDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the top LED will stay on (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TopLedDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.TopLedDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the bottom LED will stay on (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("BottomLedDurationPayload")]
+    [Description("Creates a message payload that the time the bottom LED will stay on (sensitive to multiples of 2).")]
+    public partial class CreateBottomLedDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the bottom LED will stay on (sensitive to multiples of 2).
+        /// </summary>
+        [Range(min: 2, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the time the bottom LED will stay on (sensitive to multiples of 2).")]
+        public ushort BottomLedDuration { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the BottomLedDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BottomLedDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the bottom LED will stay on (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BottomLedDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.BottomLedDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the bottom LED will stay on (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TimestampedBottomLedDurationPayload")]
+    [Description("Creates a timestamped message payload that the time the bottom LED will stay on (sensitive to multiples of 2).")]
+    public partial class CreateTimestampedBottomLedDurationPayload : CreateBottomLedDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the bottom LED will stay on (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BottomLedDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.BottomLedDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the frequency of the buzzer notification.
+    /// </summary>
+    [DisplayName("BuzzerFrequencyPayload")]
+    [Description("Creates a message payload that the frequency of the buzzer notification.")]
+    public partial class CreateBuzzerFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the frequency of the buzzer notification.
+        /// </summary>
+        [Range(min: 200, max: 15000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the frequency of the buzzer notification.")]
+        public ushort BuzzerFrequency { get; set; } = 200;
+
+        /// <summary>
+        /// Creates a message payload for the BuzzerFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BuzzerFrequency;
+        }
+
+        /// <summary>
+        /// Creates a message that the frequency of the buzzer notification.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BuzzerFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.BuzzerFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the frequency of the buzzer notification.
+    /// </summary>
+    [DisplayName("TimestampedBuzzerFrequencyPayload")]
+    [Description("Creates a timestamped message payload that the frequency of the buzzer notification.")]
+    public partial class CreateTimestampedBuzzerFrequencyPayload : CreateBuzzerFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the frequency of the buzzer notification.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BuzzerFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.BuzzerFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the blink period of the top LED notification (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TopLedPeriodPayload")]
+    [Description("Creates a message payload that the blink period of the top LED notification (sensitive to multiples of 2).")]
+    public partial class CreateTopLedPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the blink period of the top LED notification (sensitive to multiples of 2).
+        /// </summary>
+        [Range(min: 2, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the blink period of the top LED notification (sensitive to multiples of 2).")]
+        public ushort TopLedPeriod { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the TopLedPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return TopLedPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that the blink period of the top LED notification (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TopLedPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.TopLedPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the blink period of the top LED notification (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TimestampedTopLedPeriodPayload")]
+    [Description("Creates a timestamped message payload that the blink period of the top LED notification (sensitive to multiples of 2).")]
+    public partial class CreateTimestampedTopLedPeriodPayload : CreateTopLedPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the blink period of the top LED notification (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TopLedPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.TopLedPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the blink period of the bottom LED notification (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("BottomLedPeriodPayload")]
+    [Description("Creates a message payload that the blink period of the bottom LED notification (sensitive to multiples of 2).")]
+    public partial class CreateBottomLedPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the blink period of the bottom LED notification (sensitive to multiples of 2).
+        /// </summary>
+        [Range(min: 2, max: long.MaxValue)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that the blink period of the bottom LED notification (sensitive to multiples of 2).")]
+        public ushort BottomLedPeriod { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the BottomLedPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return BottomLedPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that the blink period of the bottom LED notification (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the BottomLedPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.BottomLedPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the blink period of the bottom LED notification (sensitive to multiples of 2).
+    /// </summary>
+    [DisplayName("TimestampedBottomLedPeriodPayload")]
+    [Description("Creates a timestamped message payload that the blink period of the bottom LED notification (sensitive to multiples of 2).")]
+    public partial class CreateTimestampedBottomLedPeriodPayload : CreateBottomLedPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the blink period of the bottom LED notification (sensitive to multiples of 2).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the BottomLedPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.BottomLedPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("MatchTagId0Payload")]
+    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateMatchTagId0Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
+        public ulong MatchTagId0 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId0 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return MatchTagId0;
+        }
+
+        /// <summary>
+        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId0 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId0.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId0Payload")]
+    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateTimestampedMatchTagId0Payload : CreateMatchTagId0Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId0 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId0.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("MatchTagId1Payload")]
+    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateMatchTagId1Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
+        public ulong MatchTagId1 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId1 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return MatchTagId1;
+        }
+
+        /// <summary>
+        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId1 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId1.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId1Payload")]
+    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateTimestampedMatchTagId1Payload : CreateMatchTagId1Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId1 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId1.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("MatchTagId2Payload")]
+    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateMatchTagId2Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
+        public ulong MatchTagId2 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId2 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return MatchTagId2;
+        }
+
+        /// <summary>
+        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId2 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId2.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId2Payload")]
+    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateTimestampedMatchTagId2Payload : CreateMatchTagId2Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId2 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId2.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("MatchTagId3Payload")]
+    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateMatchTagId3Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
+        public ulong MatchTagId3 { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId3 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return MatchTagId3;
+        }
+
+        /// <summary>
+        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId3 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId3.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId3Payload")]
+    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
+    public partial class CreateTimestampedMatchTagId3Payload : CreateMatchTagId3Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId3 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId3.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("MatchTagId0PulseWidthPayload")]
+    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateMatchTagId0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+        public ushort MatchTagId0PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return MatchTagId0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateTimestampedMatchTagId0PulseWidthPayload : CreateMatchTagId0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("MatchTagId1PulseWidthPayload")]
+    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateMatchTagId1PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+        public ushort MatchTagId1PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId1PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return MatchTagId1PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId1PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId1PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId1PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateTimestampedMatchTagId1PulseWidthPayload : CreateMatchTagId1PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId1PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId1PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("MatchTagId2PulseWidthPayload")]
+    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateMatchTagId2PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+        public ushort MatchTagId2PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId2PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return MatchTagId2PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId2PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId2PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId2PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateTimestampedMatchTagId2PulseWidthPayload : CreateMatchTagId2PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId2PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId2PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("MatchTagId3PulseWidthPayload")]
+    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateMatchTagId3PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+        public ushort MatchTagId3PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MatchTagId3PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return MatchTagId3PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTagId3PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId3PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// </summary>
+    [DisplayName("TimestampedMatchTagId3PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
+    public partial class CreateTimestampedMatchTagId3PulseWidthPayload : CreateMatchTagId3PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTagId3PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTagId3PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the time the digital output pin will stay on (ms) if any tag is detected.
+    /// </summary>
+    [DisplayName("AnyTagIdPulseWidthPayload")]
+    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if any tag is detected.")]
+    public partial class CreateAnyTagIdPulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the time the digital output pin will stay on (ms) if any tag is detected.
+        /// </summary>
+        [Description("The value that the time the digital output pin will stay on (ms) if any tag is detected.")]
+        public ushort AnyTagIdPulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnyTagIdPulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return AnyTagIdPulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that the time the digital output pin will stay on (ms) if any tag is detected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnyTagIdPulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.AnyTagIdPulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the time the digital output pin will stay on (ms) if any tag is detected.
+    /// </summary>
+    [DisplayName("TimestampedAnyTagIdPulseWidthPayload")]
+    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if any tag is detected.")]
+    public partial class CreateTimestampedAnyTagIdPulseWidthPayload : CreateAnyTagIdPulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if any tag is detected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnyTagIdPulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.AnyTagIdPulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that triggers the digital output pin for the specified duration (ms).
+    /// </summary>
+    [DisplayName("DO0PulseWidthPayload")]
+    [Description("Creates a message payload that triggers the digital output pin for the specified duration (ms).")]
+    public partial class CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that triggers the digital output pin for the specified duration (ms).
+        /// </summary>
+        [Description("The value that triggers the digital output pin for the specified duration (ms).")]
+        public ushort DO0PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that triggers the digital output pin for the specified duration (ms).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.DO0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that triggers the digital output pin for the specified duration (ms).
+    /// </summary>
+    [DisplayName("TimestampedDO0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that triggers the digital output pin for the specified duration (ms).")]
+    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that triggers the digital output pin for the specified duration (ms).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the detection log kept on the EEPROM.
+    /// </summary>
+    [DisplayName("DetectionLogConfigPayload")]
+    [Description("Creates a message payload that configures the detection log kept on the EEPROM.")]
+    public partial class CreateDetectionLogConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the detection log kept on the EEPROM.
+        /// </summary>
+        [Description("The value that configures the detection log kept on the EEPROM.")]
+        public DetectionLogOptions DetectionLogConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DetectionLogConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DetectionLogOptions GetPayload()
+        {
+            return DetectionLogConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the detection log kept on the EEPROM.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DetectionLogConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the detection log kept on the EEPROM.
+    /// </summary>
+    [DisplayName("TimestampedDetectionLogConfigPayload")]
+    [Description("Creates a timestamped message payload that configures the detection log kept on the EEPROM.")]
+    public partial class CreateTimestampedDetectionLogConfigPayload : CreateDetectionLogConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the detection log kept on the EEPROM.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DetectionLogConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the number of logged detection events not yet acknowledged by the host.
+    /// </summary>
+    [DisplayName("DetectionLogPendingPayload")]
+    [Description("Creates a message payload that the number of logged detection events not yet acknowledged by the host.")]
+    public partial class CreateDetectionLogPendingPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the number of logged detection events not yet acknowledged by the host.
+        /// </summary>
+        [Description("The value that the number of logged detection events not yet acknowledged by the host.")]
+        public ushort DetectionLogPending { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DetectionLogPending register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DetectionLogPending;
+        }
+
+        /// <summary>
+        /// Creates a message that the number of logged detection events not yet acknowledged by the host.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DetectionLogPending register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogPending.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the number of logged detection events not yet acknowledged by the host.
+    /// </summary>
+    [DisplayName("TimestampedDetectionLogPendingPayload")]
+    [Description("Creates a timestamped message payload that the number of logged detection events not yet acknowledged by the host.")]
+    public partial class CreateTimestampedDetectionLogPendingPayload : CreateDetectionLogPendingPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the number of logged detection events not yet acknowledged by the host.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DetectionLogPending register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogPending.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.
+    /// </summary>
+    [DisplayName("DetectionLogRecordsPayload")]
+    [Description("Creates a message payload that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.")]
+    public partial class CreateDetectionLogRecordsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.
+        /// </summary>
+        [Description("The value that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.")]
+        public byte[] DetectionLogRecords { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DetectionLogRecords register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return DetectionLogRecords;
+        }
+
+        /// <summary>
+        /// Creates a message that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DetectionLogRecords register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogRecords.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.
+    /// </summary>
+    [DisplayName("TimestampedDetectionLogRecordsPayload")]
+    [Description("Creates a timestamped message payload that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.")]
+    public partial class CreateTimestampedDetectionLogRecordsPayload : CreateDetectionLogRecordsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the 2 oldest unacknowledged detection events, 16 bytes each (tag ID U64, second U32, microsecond U16 in units of 32 us, address U8 and sequence number U8). A record with address 0 is empty.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DetectionLogRecords register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogRecords.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.
+    /// </summary>
+    [DisplayName("DetectionLogAckPayload")]
+    [Description("Creates a message payload that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.")]
+    public partial class CreateDetectionLogAckPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.
+        /// </summary>
+        [Description("The value that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.")]
+        public byte DetectionLogAck { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DetectionLogAck register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return DetectionLogAck;
+        }
+
+        /// <summary>
+        /// Creates a message that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DetectionLogAck register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogAck.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.
+    /// </summary>
+    [DisplayName("TimestampedDetectionLogAckPayload")]
+    [Description("Creates a timestamped message payload that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.")]
+    public partial class CreateTimestampedDetectionLogAckPayload : CreateDetectionLogAckPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that acknowledges the logged detection events up to the one with the specified sequence number, the newest the host read. Ignored if no pending event has that sequence number, as when the log was full and overwrote the events read.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DetectionLogAck register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.DetectionLogAck.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.
+    /// </summary>
+    [DisplayName("ConfigImagePayload")]
+    [Description("Creates a message payload that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.")]
+    public partial class CreateConfigImagePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.
+        /// </summary>
+        [Description("The value that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.")]
+        public ConfigImageCommands ConfigImage { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ConfigImage register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ConfigImageCommands GetPayload()
+        {
+            return ConfigImage;
+        }
+
+        /// <summary>
+        /// Creates a message that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ConfigImage register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.ConfigImage.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.
+    /// </summary>
+    [DisplayName("TimestampedConfigImagePayload")]
+    [Description("Creates a timestamped message payload that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.")]
+    public partial class CreateTimestampedConfigImagePayload : CreateConfigImagePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that saves or erases the configuration image (match tables, rules, notifications and the reader's setup) loaded from the EEPROM at boot. At boot the image takes precedence over the defaults and over the registers the core keeps on the EEPROM. A reset from the host doesn't load it, so the reset to the defaults (or to the core's EEPROM) holds until the next boot. Reads Save while saving.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ConfigImage register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.ConfigImage.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.
+    /// </summary>
+    [DisplayName("MatchTablePayload")]
+    [Description("Creates a message payload that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.")]
+    public partial class CreateMatchTablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.
+        /// </summary>
+        [Description("The value that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.")]
+        public byte[] MatchTable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MatchTable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return MatchTable;
+        }
+
+        /// <summary>
+        /// Creates a message that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MatchTable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.
+    /// </summary>
+    [DisplayName("TimestampedMatchTablePayload")]
+    [Description("Creates a timestamped message payload that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.")]
+    public partial class CreateTimestampedMatchTablePayload : CreateMatchTablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that match table written in a single message. It holds only 2 entries, the configuration image and the SRAM have no room for more. Each entry is tag ID (U64), digital output pulse width in ms (U16), hardware notifications (U8), refractory time in ms (U16), quota (U8) and quota window in s (U16). Entries with ID 0 are not used. The activations of an entry closer than the refractory time to the previous one, or beyond the quota within the window started by the first activation, don't pulse the digital output nor trigger the notifications. Both are measured on the detections' timestamps and apply only to this table, not to TagMatch0 to TagMatch3. Zero disables the refractory time or the quota.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MatchTable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.MatchTable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures which frames received from the reader module are published on RawFrame.
+    /// </summary>
+    [DisplayName("RawFrameConfigPayload")]
+    [Description("Creates a message payload that configures which frames received from the reader module are published on RawFrame.")]
+    public partial class CreateRawFrameConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures which frames received from the reader module are published on RawFrame.
+        /// </summary>
+        [Description("The value that configures which frames received from the reader module are published on RawFrame.")]
+        public RawFrameOptions RawFrameConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RawFrameConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public RawFrameOptions GetPayload()
+        {
+            return RawFrameConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that configures which frames received from the reader module are published on RawFrame.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RawFrameConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.RawFrameConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures which frames received from the reader module are published on RawFrame.
+    /// </summary>
+    [DisplayName("TimestampedRawFrameConfigPayload")]
+    [Description("Creates a timestamped message payload that configures which frames received from the reader module are published on RawFrame.")]
+    public partial class CreateTimestampedRawFrameConfigPayload : CreateRawFrameConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures which frames received from the reader module are published on RawFrame.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RawFrameConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.RawFrameConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.
+    /// </summary>
+    [DisplayName("RawFramePayload")]
+    [Description("Creates a message payload that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.")]
+    public partial class CreateRawFramePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.
+        /// </summary>
+        [Description("The value that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.")]
+        public byte[] RawFrame { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the RawFrame register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return RawFrame;
+        }
+
+        /// <summary>
+        /// Creates a message that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the RawFrame register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.RawFrame.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.
+    /// </summary>
+    [DisplayName("TimestampedRawFramePayload")]
+    [Description("Creates a timestamped message payload that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.")]
+    public partial class CreateTimestampedRawFramePayload : CreateRawFramePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the length of a frame received from the reader module, followed by its first 30 bytes as received. Timestamped at the first byte.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the RawFrame register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.RawFrame.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the frame formats decoded from the reader module.
+    /// </summary>
+    [DisplayName("ReaderProtocolsPayload")]
+    [Description("Creates a message payload that enables the frame formats decoded from the reader module.")]
+    public partial class CreateReaderProtocolsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the frame formats decoded from the reader module.
+        /// </summary>
+        [Description("The value that enables the frame formats decoded from the reader module.")]
+        public TagProtocols ReaderProtocols { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ReaderProtocols register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public TagProtocols GetPayload()
+        {
+            return ReaderProtocols;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the frame formats decoded from the reader module.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ReaderProtocols register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.ReaderProtocols.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the frame formats decoded from the reader module.
+    /// </summary>
+    [DisplayName("TimestampedReaderProtocolsPayload")]
+    [Description("Creates a timestamped message payload that enables the frame formats decoded from the reader module.")]
+    public partial class CreateTimestampedReaderProtocolsPayload : CreateReaderProtocolsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the frame formats decoded from the reader module.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ReaderProtocols register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.ReaderProtocols.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that selects the output of the reader module that is decoded.
+    /// </summary>
+    [DisplayName("ReaderInterfacePayload")]
+    [Description("Creates a message payload that selects the output of the reader module that is decoded.")]
+    public partial class CreateReaderInterfacePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that selects the output of the reader module that is decoded.
+        /// </summary>
+        [Description("The value that selects the output of the reader module that is decoded.")]
+        public ReaderOutput ReaderInterface { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ReaderInterface register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ReaderOutput GetPayload()
+        {
+            return ReaderInterface;
+        }
+
+        /// <summary>
+        /// Creates a message that selects the output of the reader module that is decoded.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ReaderInterface register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.ReaderInterface.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that selects the output of the reader module that is decoded.
+    /// </summary>
+    [DisplayName("TimestampedReaderInterfacePayload")]
+    [Description("Creates a timestamped message payload that selects the output of the reader module that is decoded.")]
+    public partial class CreateTimestampedReaderInterfacePayload : CreateReaderInterfacePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that selects the output of the reader module that is decoded.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ReaderInterface register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.ReaderInterface.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.
+    /// </summary>
+    [DisplayName("TagIdAntennaPayload")]
+    [Description("Creates a message payload that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.")]
+    public partial class CreateTagIdAntennaPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.
+        /// </summary>
+        [Description("The value that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.")]
+        public byte TagIdAntenna { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TagIdAntenna register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return TagIdAntenna;
+        }
+
+        /// <summary>
+        /// Creates a message that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TagIdAntenna register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.TagIdAntenna.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.
+    /// </summary>
+    [DisplayName("TimestampedTagIdAntennaPayload")]
+    [Description("Creates a timestamped message payload that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.")]
+    public partial class CreateTimestampedTagIdAntennaPayload : CreateTagIdAntennaPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the reader module that detected the tag of the following InboundDetectionId event. Only sent by firmware built with more than one reader module.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TagIdAntenna register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.TagIdAntenna.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the compact detection events and the events of tags that don't match.
+    /// </summary>
+    [DisplayName("EventConfigPayload")]
+    [Description("Creates a message payload that configures the compact detection events and the events of tags that don't match.")]
+    public partial class CreateEventConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the compact detection events and the events of tags that don't match.
+        /// </summary>
+        [Description("The value that configures the compact detection events and the events of tags that don't match.")]
+        public EventOptions EventConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EventOptions GetPayload()
+        {
+            return EventConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the compact detection events and the events of tags that don't match.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.EventConfig.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the compact detection events and the events of tags that don't match.
+    /// </summary>
+    [DisplayName("TimestampedEventConfigPayload")]
+    [Description("Creates a timestamped message payload that configures the compact detection events and the events of tags that don't match.")]
+    public partial class CreateTimestampedEventConfigPayload : CreateEventConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the compact detection events and the events of tags that don't match.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.EventConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.
+    /// </summary>
+    [DisplayName("InboundMatchIndexPayload")]
+    [Description("Creates a message payload that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.")]
+    public partial class CreateInboundMatchIndexPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.
+        /// </summary>
+        [Description("The value that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.")]
+        public byte InboundMatchIndex { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the InboundMatchIndex register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return InboundMatchIndex;
+        }
+
+        /// <summary>
+        /// Creates a message that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the InboundMatchIndex register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.InboundMatchIndex.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.
+    /// </summary>
+    [DisplayName("TimestampedInboundMatchIndexPayload")]
+    [Description("Creates a timestamped message payload that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.")]
+    public partial class CreateTimestampedInboundMatchIndexPayload : CreateInboundMatchIndexPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the index of the matching ID of the tag that entered the area of the reader. 0 to 3 are MatchTagId0 to 3 and 4 onwards are the MatchTable entries.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the InboundMatchIndex register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.InboundMatchIndex.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the index of the matching ID of the tag that exited the area of the reader.
+    /// </summary>
+    [DisplayName("OutboundMatchIndexPayload")]
+    [Description("Creates a message payload that the index of the matching ID of the tag that exited the area of the reader.")]
+    public partial class CreateOutboundMatchIndexPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the index of the matching ID of the tag that exited the area of the reader.
+        /// </summary>
+        [Description("The value that the index of the matching ID of the tag that exited the area of the reader.")]
+        public byte OutboundMatchIndex { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutboundMatchIndex register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return OutboundMatchIndex;
+        }
+
+        /// <summary>
+        /// Creates a message that the index of the matching ID of the tag that exited the area of the reader.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutboundMatchIndex register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.OutboundMatchIndex.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the index of the matching ID of the tag that exited the area of the reader.
+    /// </summary>
+    [DisplayName("TimestampedOutboundMatchIndexPayload")]
+    [Description("Creates a timestamped message payload that the index of the matching ID of the tag that exited the area of the reader.")]
+    public partial class CreateTimestampedOutboundMatchIndexPayload : CreateOutboundMatchIndexPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the index of the matching ID of the tag that exited the area of the reader.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutboundMatchIndex register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.OutboundMatchIndex.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that the ID of a detected tag that doesn't match any of the IDs to match.
+    /// </summary>
+    [DisplayName("UnmatchedDetectionIdPayload")]
+    [Description("Creates a message payload that the ID of a detected tag that doesn't match any of the IDs to match.")]
+    public partial class CreateUnmatchedDetectionIdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that the ID of a detected tag that doesn't match any of the IDs to match.
+        /// </summary>
+        [Description("The value that the ID of a detected tag that doesn't match any of the IDs to match.")]
+        public ulong UnmatchedDetectionId { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the UnmatchedDetectionId register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return UnmatchedDetectionId;
+        }
+
+        /// <summary>
+        /// Creates a message that the ID of a detected tag that doesn't match any of the IDs to match.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the UnmatchedDetectionId register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.RfidReader.UnmatchedDetectionId.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that the ID of a detected tag that doesn't match any of the IDs to match.
+    /// </summary>
+    [DisplayName("TimestampedUnmatchedDetectionIdPayload")]
+    [Description("Creates a timestamped message payload that the ID of a detected tag that doesn't match any of the IDs to match.")]
+    public partial class CreateTimestampedUnmatchedDetectionIdPayload : CreateUnmatchedDetectionIdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that the ID of a detected tag that doesn't match any of the IDs to match.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the UnmatchedDetectionId register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.UnmatchedDetectionId.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the statistics event sent each second.
+    /// </summary>
+    [DisplayName("StatisticsConfigPayload")]
+    [Description("Creates a message payload that enables the statistics event sent each second.")]
+    public partial class CreateStatisticsConfigPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that enables the statistics event sent each second.
+        /// </summary>
+        [Description("The value that enables the statistics event sent each second.")]
+        public StatisticsOptions StatisticsConfig { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StatisticsConfig register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StatisticsOptions GetPayload()
+        {
+            return StatisticsConfig;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the statistics event sent each second.
         /// </summary>
-        public CreateMessage()
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StatisticsConfig register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
         {
-            Payload = new CreateInboundDetectionIdPayload();
+            return Harp.RfidReader.StatisticsConfig.FromPayload(messageType, GetPayload());
         }
+    }
 
-        string INamedElement.Name => $"{nameof(RfidReader)}.{GetElementDisplayName(Payload)}";
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the statistics event sent each second.
+    /// </summary>
+    [DisplayName("TimestampedStatisticsConfigPayload")]
+    [Description("Creates a timestamped message payload that enables the statistics event sent each second.")]
+    public partial class CreateTimestampedStatisticsConfigPayload : CreateStatisticsConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the statistics event sent each second.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StatisticsConfig register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.RfidReader.StatisticsConfig.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the ID of the tag that was detected as having entered the area of the reader.
+    /// that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.
     /// </summary>
-    [DisplayName("InboundDetectionIdPayload")]
-    [Description("Creates a message payload that the ID of the tag that was detected as having entered the area of the reader.")]
-    public partial class CreateInboundDetectionIdPayload
+    [DisplayName("StatisticsPayload")]
+    [Description("Creates a message payload that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.")]
+    public partial class CreateStatisticsPayload
     {
         /// <summary>
-        /// Gets or sets the value that the ID of the tag that was detected as having entered the area of the reader.
+        /// Gets or sets the value that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.
         /// </summary>
-        [Description("The value that the ID of the tag that was detected as having entered the area of the reader.")]
-        public ulong InboundDetectionId { get; set; }
+        [Description("The value that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.")]
+        public ushort[] Statistics { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the InboundDetectionId register.
+        /// Creates a message payload for the Statistics register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ulong GetPayload()
+        public ushort[] GetPayload()
         {
-            return InboundDetectionId;
+            return Statistics;
         }
 
         /// <summary>
-        /// Creates a message that the ID of the tag that was detected as having entered the area of the reader.
+        /// Creates a message that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the InboundDetectionId register.</returns>
+        /// <returns>A new message for the Statistics register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.InboundDetectionId.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.Statistics.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the ID of the tag that was detected as having entered the area of the reader.
+    /// that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.
     /// </summary>
-    [DisplayName("TimestampedInboundDetectionIdPayload")]
-    [Description("Creates a timestamped message payload that the ID of the tag that was detected as having entered the area of the reader.")]
-    public partial class CreateTimestampedInboundDetectionIdPayload : CreateInboundDetectionIdPayload
+    [DisplayName("TimestampedStatisticsPayload")]
+    [Description("Creates a timestamped message payload that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.")]
+    public partial class CreateTimestampedStatisticsPayload : CreateStatisticsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the ID of the tag that was detected as having entered the area of the reader.
+        /// Creates a timestamped message that on the last second, the number of detections (repeated frames of the tag in range not counted), unique tags, time with a tag in range (ms) and frames that couldn't be decoded.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the InboundDetectionId register.</returns>
+        /// <returns>A new timestamped message for the Statistics register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.InboundDetectionId.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.Statistics.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the ID of the tag that was detected as having exited the area of the reader.
+    /// that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.
     /// </summary>
-    [DisplayName("OutboundDetectionIdPayload")]
-    [Description("Creates a message payload that the ID of the tag that was detected as having exited the area of the reader.")]
-    public partial class CreateOutboundDetectionIdPayload
+    [DisplayName("PresenceQualityPayload")]
+    [Description("Creates a message payload that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.")]
+    public partial class CreatePresenceQualityPayload
     {
         /// <summary>
-        /// Gets or sets the value that the ID of the tag that was detected as having exited the area of the reader.
+        /// Gets or sets the value that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.
         /// </summary>
-        [Description("The value that the ID of the tag that was detected as having exited the area of the reader.")]
-        public ulong OutboundDetectionId { get; set; }
+        [Description("The value that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.")]
+        public ushort[] PresenceQuality { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutboundDetectionId register.
+        /// Creates a message payload for the PresenceQuality register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ulong GetPayload()
+        public ushort[] GetPayload()
         {
-            return OutboundDetectionId;
+            return PresenceQuality;
         }
 
         /// <summary>
-        /// Creates a message that the ID of the tag that was detected as having exited the area of the reader.
+        /// Creates a message that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutboundDetectionId register.</returns>
+        /// <returns>A new message for the PresenceQuality register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.OutboundDetectionId.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.PresenceQuality.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the ID of the tag that was detected as having exited the area of the reader.
+    /// that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.
     /// </summary>
-    [DisplayName("TimestampedOutboundDetectionIdPayload")]
-    [Description("Creates a timestamped message payload that the ID of the tag that was detected as having exited the area of the reader.")]
-    public partial class CreateTimestampedOutboundDetectionIdPayload : CreateOutboundDetectionIdPayload
+    [DisplayName("TimestampedPresenceQualityPayload")]
+    [Description("Creates a timestamped message payload that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.")]
+    public partial class CreateTimestampedPresenceQualityPayload : CreatePresenceQualityPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the ID of the tag that was detected as having exited the area of the reader.
+        /// Creates a timestamped message that sent before the OutboundDetectionId event. Valid frames, frames that couldn't be decoded, mean and minimum interval between valid frames (ms) while the tag was in range.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutboundDetectionId register.</returns>
+        /// <returns>A new timestamped message for the PresenceQuality register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.OutboundDetectionId.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.PresenceQuality.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that changes the state of the digital output pin.
+    /// that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.
     /// </summary>
-    [DisplayName("DO0StatePayload")]
-    [Description("Creates a message payload that changes the state of the digital output pin.")]
-    public partial class CreateDO0StatePayload
+    [DisplayName("LatencyHistogramPayload")]
+    [Description("Creates a message payload that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.")]
+    public partial class CreateLatencyHistogramPayload
     {
         /// <summary>
-        /// Gets or sets the value that changes the state of the digital output pin.
+        /// Gets or sets the value that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.
         /// </summary>
-        [Description("The value that changes the state of the digital output pin.")]
-        public DigitalState DO0State { get; set; }
+        [Description("The value that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.")]
+        public ushort[] LatencyHistogram { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0State register.
+        /// Creates a message payload for the LatencyHistogram register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalState GetPayload()
+        public ushort[] GetPayload()
         {
-            return DO0State;
+            return LatencyHistogram;
         }
 
         /// <summary>
-        /// Creates a message that changes the state of the digital output pin.
+        /// Creates a message that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0State register.</returns>
+        /// <returns>A new message for the LatencyHistogram register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.DO0State.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.LatencyHistogram.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that changes the state of the digital output pin.
+    /// that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.
     /// </summary>
-    [DisplayName("TimestampedDO0StatePayload")]
-    [Description("Creates a timestamped message payload that changes the state of the digital output pin.")]
-    public partial class CreateTimestampedDO0StatePayload : CreateDO0StatePayload
+    [DisplayName("TimestampedLatencyHistogramPayload")]
+    [Description("Creates a timestamped message payload that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.")]
+    public partial class CreateTimestampedLatencyHistogramPayload : CreateLatencyHistogramPayload
     {
         /// <summary>
-        /// Creates a timestamped message that changes the state of the digital output pin.
+        /// Creates a timestamped message that histograms of the first to last byte of a frame, last byte to the detection event and detection event to OUT0 asserted, 8 buckets each with limits of 0.5, 1, 2, 4, 8, 16 and 32 ms. Any write resets the histograms.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0State register.</returns>
+        /// <returns>A new timestamped message for the LatencyHistogram register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.DO0State.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.LatencyHistogram.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables or disables hardware notifications.
+    /// that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.
     /// </summary>
-    [DisplayName("HardwareNotificationsStatePayload")]
-    [Description("Creates a message payload that enables or disables hardware notifications.")]
-    public partial class CreateHardwareNotificationsStatePayload
+    [DisplayName("RulesPayload")]
+    [Description("Creates a message payload that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.")]
+    public partial class CreateRulesPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables or disables hardware notifications.
+        /// Gets or sets the value that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.
         /// </summary>
-        [Description("The value that enables or disables hardware notifications.")]
-        public HardwareNotifications HardwareNotificationsState { get; set; }
+        [Description("The value that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.")]
+        public byte[] Rules { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the HardwareNotificationsState register.
+        /// Creates a message payload for the Rules register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public HardwareNotifications GetPayload()
+        public byte[] GetPayload()
         {
-            return HardwareNotificationsState;
+            return Rules;
         }
 
         /// <summary>
-        /// Creates a message that enables or disables hardware notifications.
+        /// Creates a message that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the HardwareNotificationsState register.</returns>
+        /// <returns>A new message for the Rules register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.HardwareNotificationsState.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.Rules.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables or disables hardware notifications.
+    /// that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.
     /// </summary>
-    [DisplayName("TimestampedHardwareNotificationsStatePayload")]
-    [Description("Creates a timestamped message payload that enables or disables hardware notifications.")]
-    public partial class CreateTimestampedHardwareNotificationsStatePayload : CreateHardwareNotificationsStatePayload
+    [DisplayName("TimestampedRulesPayload")]
+    [Description("Creates a timestamped message payload that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.")]
+    public partial class CreateTimestampedRulesPayload : CreateRulesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables or disables hardware notifications.
+        /// Creates a timestamped message that 3 rules of 13 bytes, checked in order on each detection: flags (U8), match indexes (U8), minimum absence (U16, s), window start (U32, Harp seconds), window length (U16, s), OUT0 period (U16, ms) and notifications (U8). The first rule with all its conditions met applies its actions, a rule without actions is unused. Conditions on the flags: 0x1 match index on the mask (bit 7 for tags without one), 0x2 absent for the minimum absence, 0x4 TAG_IN_RANGE high, 0x8 TAG_IN_RANGE low, 0x10 within the window. Actions on the flags: 0x20 pulse OUT0 for the OUT0 period, 0x40 use the notifications, 0x80 suppress the detection events. The absence is exact up to 2 minutes, met up to a minute late after that and always met after 2 h 15 min.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the HardwareNotificationsState register.</returns>
+        /// <returns>A new timestamped message for the Rules register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.HardwareNotificationsState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.Rules.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that triggers hardware notifications.
+    /// that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.
     /// </summary>
-    [DisplayName("HardwareNotificationsTriggerPayload")]
-    [Description("Creates a message payload that triggers hardware notifications.")]
-    public partial class CreateHardwareNotificationsTriggerPayload
+    [DisplayName("SuppressedActivationsPayload")]
+    [Description("Creates a message payload that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.")]
+    public partial class CreateSuppressedActivationsPayload
     {
         /// <summary>
-        /// Gets or sets the value that triggers hardware notifications.
+        /// Gets or sets the value that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.
         /// </summary>
-        [Description("The value that triggers hardware notifications.")]
-        public HardwareNotifications HardwareNotificationsTrigger { get; set; }
+        [Description("The value that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.")]
+        public ushort[] SuppressedActivations { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the HardwareNotificationsTrigger register.
+        /// Creates a message payload for the SuppressedActivations register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public HardwareNotifications GetPayload()
+        public ushort[] GetPayload()
         {
-            return HardwareNotificationsTrigger;
+            return SuppressedActivations;
         }
 
         /// <summary>
-        /// Creates a message that triggers hardware notifications.
+        /// Creates a message that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the HardwareNotificationsTrigger register.</returns>
+        /// <returns>A new message for the SuppressedActivations register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.HardwareNotificationsTrigger.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.SuppressedActivations.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that triggers hardware notifications.
+    /// that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.
     /// </summary>
-    [DisplayName("TimestampedHardwareNotificationsTriggerPayload")]
-    [Description("Creates a timestamped message payload that triggers hardware notifications.")]
-    public partial class CreateTimestampedHardwareNotificationsTriggerPayload : CreateHardwareNotificationsTriggerPayload
+    [DisplayName("TimestampedSuppressedActivationsPayload")]
+    [Description("Creates a timestamped message payload that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.")]
+    public partial class CreateTimestampedSuppressedActivationsPayload : CreateSuppressedActivationsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that triggers hardware notifications.
+        /// Creates a timestamped message that activations suppressed by the refractory time or the quota of each MatchTable entry. Any write resets the counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the HardwareNotificationsTrigger register.</returns>
+        /// <returns>A new timestamped message for the SuppressedActivations register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.HardwareNotificationsTrigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.SuppressedActivations.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the buzzer will stay on (sensitive to multiples of 2).
+    /// that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.
     /// </summary>
-    [DisplayName("BuzzerDurationPayload")]
-    [Description("Creates a message payload that the time the buzzer will stay on (sensitive to multiples of 2).")]
-    public partial class CreateBuzzerDurationPayload
+    [DisplayName("TagPresentPayload")]
+    [Description("Creates a message payload that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.")]
+    public partial class CreateTagPresentPayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the buzzer will stay on (sensitive to multiples of 2).
+        /// Gets or sets the value that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.
         /// </summary>
-        [Range(min: 2, max: long.MaxValue)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the time the buzzer will stay on (sensitive to multiples of 2).")]
-        public ushort BuzzerDuration { get; set; } = 2;
+        [Description("The value that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.")]
+        public byte TagPresent { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the BuzzerDuration register.
+        /// Creates a message payload for the TagPresent register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return BuzzerDuration;
+            return TagPresent;
         }
 
         /// <summary>
-        /// Creates a message that the time the buzzer will stay on (sensitive to multiples of 2).
+        /// Creates a message that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the BuzzerDuration register.</returns>
+        /// <returns>A new message for the TagPresent register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.BuzzerDuration.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.TagPresent.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the buzzer will stay on (sensitive to multiples of 2).
+    /// that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.
     /// </summary>
-    [DisplayName("TimestampedBuzzerDurationPayload")]
-    [Description("Creates a timestamped message payload that the time the buzzer will stay on (sensitive to multiples of 2).")]
-    public partial class CreateTimestampedBuzzerDurationPayload : CreateBuzzerDurationPayload
+    [DisplayName("TimestampedTagPresentPayload")]
+    [Description("Creates a timestamped message payload that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.")]
+    public partial class CreateTimestampedTagPresentPayload : CreateTagPresentPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the buzzer will stay on (sensitive to multiples of 2).
+        /// Creates a timestamped message that sent on the rising edge of TAG_IN_RANGE, before the tag's ID is known. The InboundDetectionId event that follows has the same timestamp.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the BuzzerDuration register.</returns>
+        /// <returns>A new timestamped message for the TagPresent register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.BuzzerDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.TagPresent.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the top LED will stay on (sensitive to multiples of 2).
+    /// that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.
     /// </summary>
-    [DisplayName("TopLedDurationPayload")]
-    [Description("Creates a message payload that the time the top LED will stay on (sensitive to multiples of 2).")]
-    public partial class CreateTopLedDurationPayload
+    [DisplayName("TagPresentPulseWidthPayload")]
+    [Description("Creates a message payload that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.")]
+    public partial class CreateTagPresentPulseWidthPayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the top LED will stay on (sensitive to multiples of 2).
+        /// Gets or sets the value that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.
         /// </summary>
-        [Range(min: 2, max: long.MaxValue)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the time the top LED will stay on (sensitive to multiples of 2).")]
-        public ushort TopLedDuration { get; set; } = 2;
+        [Description("The value that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.")]
+        public ushort TagPresentPulseWidth { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the TopLedDuration register.
+        /// Creates a message payload for the TagPresentPulseWidth register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return TopLedDuration;
+            return TagPresentPulseWidth;
         }
 
         /// <summary>
-        /// Creates a message that the time the top LED will stay on (sensitive to multiples of 2).
+        /// Creates a message that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TopLedDuration register.</returns>
+        /// <returns>A new message for the TagPresentPulseWidth register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.TopLedDuration.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.TagPresentPulseWidth.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the top LED will stay on (sensitive to multiples of 2).
+    /// that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.
     /// </summary>
-    [DisplayName("TimestampedTopLedDurationPayload")]
-    [Description("Creates a timestamped message payload that the time the top LED will stay on (sensitive to multiples of 2).")]
-    public partial class CreateTimestampedTopLedDurationPayload : CreateTopLedDurationPayload
+    [DisplayName("TimestampedTagPresentPulseWidthPayload")]
+    [Description("Creates a timestamped message payload that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.")]
+    public partial class CreateTimestampedTagPresentPulseWidthPayload : CreateTagPresentPulseWidthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the top LED will stay on (sensitive to multiples of 2).
+        /// Creates a timestamped message that pulse width of the digital output started on the rising edge of TAG_IN_RANGE, in ms. 0 disables the pulse.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TopLedDuration register.</returns>
+        /// <returns>A new timestamped message for the TagPresentPulseWidth register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.TopLedDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.TagPresentPulseWidth.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the bottom LED will stay on (sensitive to multiples of 2).
+    /// that hardware notifications triggered on the rising edge of TAG_IN_RANGE.
     /// </summary>
-    [DisplayName("BottomLedDurationPayload")]
-    [Description("Creates a message payload that the time the bottom LED will stay on (sensitive to multiples of 2).")]
-    public partial class CreateBottomLedDurationPayload
+    [DisplayName("TagPresentNotificationsPayload")]
+    [Description("Creates a message payload that hardware notifications triggered on the rising edge of TAG_IN_RANGE.")]
+    public partial class CreateTagPresentNotificationsPayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the bottom LED will stay on (sensitive to multiples of 2).
+        /// Gets or sets the value that hardware notifications triggered on the rising edge of TAG_IN_RANGE.
         /// </summary>
-        [Range(min: 2, max: long.MaxValue)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the time the bottom LED will stay on (sensitive to multiples of 2).")]
-        public ushort BottomLedDuration { get; set; } = 2;
+        [Description("The value that hardware notifications triggered on the rising edge of TAG_IN_RANGE.")]
+        public HardwareNotifications TagPresentNotifications { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the BottomLedDuration register.
+        /// Creates a message payload for the TagPresentNotifications register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public HardwareNotifications GetPayload()
         {
-            return BottomLedDuration;
+            return TagPresentNotifications;
         }
 
         /// <summary>
-        /// Creates a message that the time the bottom LED will stay on (sensitive to multiples of 2).
+        /// Creates a message that hardware notifications triggered on the rising edge of TAG_IN_RANGE.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the BottomLedDuration register.</returns>
+        /// <returns>A new message for the TagPresentNotifications register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.BottomLedDuration.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.TagPresentNotifications.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the bottom LED will stay on (sensitive to multiples of 2).
+    /// that hardware notifications triggered on the rising edge of TAG_IN_RANGE.
     /// </summary>
-    [DisplayName("TimestampedBottomLedDurationPayload")]
-    [Description("Creates a timestamped message payload that the time the bottom LED will stay on (sensitive to multiples of 2).")]
-    public partial class CreateTimestampedBottomLedDurationPayload : CreateBottomLedDurationPayload
+    [DisplayName("TimestampedTagPresentNotificationsPayload")]
+    [Description("Creates a timestamped message payload that hardware notifications triggered on the rising edge of TAG_IN_RANGE.")]
+    public partial class CreateTimestampedTagPresentNotificationsPayload : CreateTagPresentNotificationsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the bottom LED will stay on (sensitive to multiples of 2).
+        /// Creates a timestamped message that hardware notifications triggered on the rising edge of TAG_IN_RANGE.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the BottomLedDuration register.</returns>
+        /// <returns>A new timestamped message for the TagPresentNotifications register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.BottomLedDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.TagPresentNotifications.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the frequency of the buzzer notification.
+    /// that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.
     /// </summary>
-    [DisplayName("BuzzerFrequencyPayload")]
-    [Description("Creates a message payload that the frequency of the buzzer notification.")]
-    public partial class CreateBuzzerFrequencyPayload
+    [DisplayName("Out0GatePayload")]
+    [Description("Creates a message payload that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.")]
+    public partial class CreateOut0GatePayload
     {
         /// <summary>
-        /// Gets or sets the value that the frequency of the buzzer notification.
+        /// Gets or sets the value that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.
         /// </summary>
-        [Range(min: 200, max: 15000)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the frequency of the buzzer notification.")]
-        public ushort BuzzerFrequency { get; set; } = 200;
+        [Description("The value that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.")]
+        public Out0GateOptions Out0Gate { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the BuzzerFrequency register.
+        /// Creates a message payload for the Out0Gate register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public Out0GateOptions GetPayload()
         {
-            return BuzzerFrequency;
+            return Out0Gate;
         }
 
         /// <summary>
-        /// Creates a message that the frequency of the buzzer notification.
+        /// Creates a message that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the BuzzerFrequency register.</returns>
+        /// <returns>A new message for the Out0Gate register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.BuzzerFrequency.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.Out0Gate.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the frequency of the buzzer notification.
+    /// that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.
     /// </summary>
-    [DisplayName("TimestampedBuzzerFrequencyPayload")]
-    [Description("Creates a timestamped message payload that the frequency of the buzzer notification.")]
-    public partial class CreateTimestampedBuzzerFrequencyPayload : CreateBuzzerFrequencyPayload
+    [DisplayName("TimestampedOut0GatePayload")]
+    [Description("Creates a timestamped message payload that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.")]
+    public partial class CreateTimestampedOut0GatePayload : CreateOut0GatePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the frequency of the buzzer notification.
+        /// Creates a timestamped message that routes TAG_IN_RANGE to the digital output through the event system, so the pulse starts on the rising edge without the CPU. The digital output events are still sent.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the BuzzerFrequency register.</returns>
+        /// <returns>A new timestamped message for the Out0Gate register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.BuzzerFrequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.Out0Gate.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the blink period of the top LED notification (sensitive to multiples of 2).
+    /// that minimum pulse width of the gated digital output, in ms.
     /// </summary>
-    [DisplayName("TopLedPeriodPayload")]
-    [Description("Creates a message payload that the blink period of the top LED notification (sensitive to multiples of 2).")]
-    public partial class CreateTopLedPeriodPayload
+    [DisplayName("Out0GateMinimumPulsePayload")]
+    [Description("Creates a message payload that minimum pulse width of the gated digital output, in ms.")]
+    public partial class CreateOut0GateMinimumPulsePayload
     {
         /// <summary>
-        /// Gets or sets the value that the blink period of the top LED notification (sensitive to multiples of 2).
+        /// Gets or sets the value that minimum pulse width of the gated digital output, in ms.
         /// </summary>
-        [Range(min: 2, max: long.MaxValue)]
+        [Range(min: 2, max: 2000)]
         [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the blink period of the top LED notification (sensitive to multiples of 2).")]
-        public ushort TopLedPeriod { get; set; } = 2;
+        [Description("The value that minimum pulse width of the gated digital output, in ms.")]
+        public ushort Out0GateMinimumPulse { get; set; } = 2;
 
         /// <summary>
-        /// Creates a message payload for the TopLedPeriod register.
+        /// Creates a message payload for the Out0GateMinimumPulse register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return TopLedPeriod;
+            return Out0GateMinimumPulse;
         }
 
         /// <summary>
-        /// Creates a message that the blink period of the top LED notification (sensitive to multiples of 2).
+        /// Creates a message that minimum pulse width of the gated digital output, in ms.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TopLedPeriod register.</returns>
+        /// <returns>A new message for the Out0GateMinimumPulse register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.TopLedPeriod.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.Out0GateMinimumPulse.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the blink period of the top LED notification (sensitive to multiples of 2).
+    /// that minimum pulse width of the gated digital output, in ms.
     /// </summary>
-    [DisplayName("TimestampedTopLedPeriodPayload")]
-    [Description("Creates a timestamped message payload that the blink period of the top LED notification (sensitive to multiples of 2).")]
-    public partial class CreateTimestampedTopLedPeriodPayload : CreateTopLedPeriodPayload
+    [DisplayName("TimestampedOut0GateMinimumPulsePayload")]
+    [Description("Creates a timestamped message payload that minimum pulse width of the gated digital output, in ms.")]
+    public partial class CreateTimestampedOut0GateMinimumPulsePayload : CreateOut0GateMinimumPulsePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the blink period of the top LED notification (sensitive to multiples of 2).
+        /// Creates a timestamped message that minimum pulse width of the gated digital output, in ms.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TopLedPeriod register.</returns>
+        /// <returns>A new timestamped message for the Out0GateMinimumPulse register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.TopLedPeriod.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.Out0GateMinimumPulse.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the blink period of the bottom LED notification (sensitive to multiples of 2).
+    /// that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.
     /// </summary>
-    [DisplayName("BottomLedPeriodPayload")]
-    [Description("Creates a message payload that the blink period of the bottom LED notification (sensitive to multiples of 2).")]
-    public partial class CreateBottomLedPeriodPayload
+    [DisplayName("Out0GateHoldOffPayload")]
+    [Description("Creates a message payload that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.")]
+    public partial class CreateOut0GateHoldOffPayload
     {
         /// <summary>
-        /// Gets or sets the value that the blink period of the bottom LED notification (sensitive to multiples of 2).
+        /// Gets or sets the value that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.
         /// </summary>
-        [Range(min: 2, max: long.MaxValue)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that the blink period of the bottom LED notification (sensitive to multiples of 2).")]
-        public ushort BottomLedPeriod { get; set; } = 2;
+        [Description("The value that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.")]
+        public ushort Out0GateHoldOff { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the BottomLedPeriod register.
+        /// Creates a message payload for the Out0GateHoldOff register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return BottomLedPeriod;
+            return Out0GateHoldOff;
         }
 
         /// <summary>
-        /// Creates a message that the blink period of the bottom LED notification (sensitive to multiples of 2).
+        /// Creates a message that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the BottomLedPeriod register.</returns>
+        /// <returns>A new message for the Out0GateHoldOff register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.BottomLedPeriod.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.Out0GateHoldOff.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the blink period of the bottom LED notification (sensitive to multiples of 2).
+    /// that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.
     /// </summary>
-    [DisplayName("TimestampedBottomLedPeriodPayload")]
-    [Description("Creates a timestamped message payload that the blink period of the bottom LED notification (sensitive to multiples of 2).")]
-    public partial class CreateTimestampedBottomLedPeriodPayload : CreateBottomLedPeriodPayload
+    [DisplayName("TimestampedOut0GateHoldOffPayload")]
+    [Description("Creates a timestamped message payload that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.")]
+    public partial class CreateTimestampedOut0GateHoldOffPayload : CreateOut0GateHoldOffPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the blink period of the bottom LED notification (sensitive to multiples of 2).
+        /// Creates a timestamped message that time after a pulse of the gated digital output during which TAG_IN_RANGE is ignored, in ms.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the BottomLedPeriod register.</returns>
+        /// <returns>A new timestamped message for the Out0GateHoldOff register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.BottomLedPeriod.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.Out0GateHoldOff.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
-    /// </summary>
-    [DisplayName("MatchTagId0Payload")]
-    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateMatchTagId0Payload
+    /// that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.
+    /// </summary>
+    [DisplayName("TagInRangeFilterPayload")]
+    [Description("Creates a message payload that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.")]
+    public partial class CreateTagInRangeFilterPayload
     {
         /// <summary>
-        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Gets or sets the value that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.
         /// </summary>
-        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
-        public ulong MatchTagId0 { get; set; } = 0;
+        [Description("The value that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.")]
+        public ushort[] TagInRangeFilter { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId0 register.
+        /// Creates a message payload for the TagInRangeFilter register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ulong GetPayload()
+        public ushort[] GetPayload()
         {
-            return MatchTagId0;
+            return TagInRangeFilter;
         }
 
         /// <summary>
-        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a message that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId0 register.</returns>
+        /// <returns>A new message for the TagInRangeFilter register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId0.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.TagInRangeFilter.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId0Payload")]
-    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateTimestampedMatchTagId0Payload : CreateMatchTagId0Payload
+    [DisplayName("TimestampedTagInRangeFilterPayload")]
+    [Description("Creates a timestamped message payload that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.")]
+    public partial class CreateTimestampedTagInRangeFilterPayload : CreateTagInRangeFilterPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a timestamped message that minimum time, in ms, TAG_IN_RANGE must stay high after a rising edge and low after a falling edge for the edge to count. The edge keeps the timestamp of the first transition. 0 disables the filter for that direction.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId0 register.</returns>
+        /// <returns>A new timestamped message for the TagInRangeFilter register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId0.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.TagInRangeFilter.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.
     /// </summary>
-    [DisplayName("MatchTagId1Payload")]
-    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateMatchTagId1Payload
+    [DisplayName("TagInRangeGlitchesPayload")]
+    [Description("Creates a message payload that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.")]
+    public partial class CreateTagInRangeGlitchesPayload
     {
         /// <summary>
-        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Gets or sets the value that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.
         /// </summary>
-        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
-        public ulong MatchTagId1 { get; set; } = 0;
+        [Description("The value that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.")]
+        public ushort TagInRangeGlitches { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId1 register.
+        /// Creates a message payload for the TagInRangeGlitches register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ulong GetPayload()
+        public ushort GetPayload()
         {
-            return MatchTagId1;
+            return TagInRangeGlitches;
         }
 
         /// <summary>
-        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a message that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId1 register.</returns>
+        /// <returns>A new message for the TagInRangeGlitches register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId1.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.TagInRangeGlitches.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId1Payload")]
-    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateTimestampedMatchTagId1Payload : CreateMatchTagId1Payload
+    [DisplayName("TimestampedTagInRangeGlitchesPayload")]
+    [Description("Creates a timestamped message payload that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.")]
+    public partial class CreateTimestampedTagInRangeGlitchesPayload : CreateTagInRangeGlitchesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a timestamped message that transitions of TAG_IN_RANGE filtered out. Any write resets the counter.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId1 register.</returns>
+        /// <returns>A new timestamped message for the TagInRangeGlitches register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId1.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.TagInRangeGlitches.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.
     /// </summary>
-    [DisplayName("MatchTagId2Payload")]
-    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateMatchTagId2Payload
+    [DisplayName("WorkQueuePayload")]
+    [Description("Creates a message payload that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.")]
+    public partial class CreateWorkQueuePayload
     {
         /// <summary>
-        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Gets or sets the value that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.
         /// </summary>
-        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
-        public ulong MatchTagId2 { get; set; } = 0;
+        [Description("The value that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.")]
+        public ushort[] WorkQueue { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId2 register.
+        /// Creates a message payload for the WorkQueue register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ulong GetPayload()
+        public ushort[] GetPayload()
         {
-            return MatchTagId2;
+            return WorkQueue;
         }
 
         /// <summary>
-        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a message that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId2 register.</returns>
+        /// <returns>A new message for the WorkQueue register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId2.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.WorkQueue.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId2Payload")]
-    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateTimestampedMatchTagId2Payload : CreateMatchTagId2Payload
+    [DisplayName("TimestampedWorkQueuePayload")]
+    [Description("Creates a timestamped message payload that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.")]
+    public partial class CreateTimestampedWorkQueuePayload : CreateWorkQueuePayload
     {
         /// <summary>
-        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a timestamped message that frames and TAG_IN_RANGE edges waiting for the main loop, as the maximum depth, the worst wait in microseconds and the frames dropped, with no room on the queue or on the reader's buffer. Any write resets the counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId2 register.</returns>
+        /// <returns>A new timestamped message for the WorkQueue register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId2.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.WorkQueue.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.
     /// </summary>
-    [DisplayName("MatchTagId3Payload")]
-    [Description("Creates a message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateMatchTagId3Payload
+    [DisplayName("SelfTestPayload")]
+    [Description("Creates a message payload that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.")]
+    public partial class CreateSelfTestPayload
     {
         /// <summary>
-        /// Gets or sets the value that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Gets or sets the value that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.
         /// </summary>
-        [Description("The value that sends detection event notifications only when the tag with the specified ID is detected.")]
-        public ulong MatchTagId3 { get; set; } = 0;
+        [Description("The value that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.")]
+        public TagProtocols SelfTest { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId3 register.
+        /// Creates a message payload for the SelfTest register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ulong GetPayload()
+        public TagProtocols GetPayload()
         {
-            return MatchTagId3;
+            return SelfTest;
         }
 
         /// <summary>
-        /// Creates a message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a message that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId3 register.</returns>
+        /// <returns>A new message for the SelfTest register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId3.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.SelfTest.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sends detection event notifications only when the tag with the specified ID is detected.
+    /// that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId3Payload")]
-    [Description("Creates a timestamped message payload that sends detection event notifications only when the tag with the specified ID is detected.")]
-    public partial class CreateTimestampedMatchTagId3Payload : CreateMatchTagId3Payload
+    [DisplayName("TimestampedSelfTestPayload")]
+    [Description("Creates a timestamped message payload that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.")]
+    public partial class CreateTimestampedSelfTestPayload : CreateSelfTestPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sends detection event notifications only when the tag with the specified ID is detected.
+        /// Creates a timestamped message that starts the throughput self-test with synthetic frames of the protocols selected, which must be enabled on ReaderProtocols. Reads back 0 once done. Write 0 to stop. The reader module is ignored while running.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId3 register.</returns>
+        /// <returns>A new timestamped message for the SelfTest register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId3.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.SelfTest.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.
     /// </summary>
-    [DisplayName("MatchTagId0PulseWidthPayload")]
-    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateMatchTagId0PulseWidthPayload
+    [DisplayName("SelfTestResultPayload")]
+    [Description("Creates a message payload that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.")]
+    public partial class CreateSelfTestResultPayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Gets or sets the value that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.
         /// </summary>
-        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-        public ushort MatchTagId0PulseWidth { get; set; }
+        [Description("The value that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.")]
+        public ushort[] SelfTestResult { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId0PulseWidth register.
+        /// Creates a message payload for the SelfTestResult register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return MatchTagId0PulseWidth;
+            return SelfTestResult;
         }
 
         /// <summary>
-        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a message that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId0PulseWidth register.</returns>
+        /// <returns>A new message for the SelfTestResult register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId0PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.SelfTestResult.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId0PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateTimestampedMatchTagId0PulseWidthPayload : CreateMatchTagId0PulseWidthPayload
+    [DisplayName("TimestampedSelfTestResultPayload")]
+    [Description("Creates a timestamped message payload that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.")]
+    public partial class CreateTimestampedSelfTestResultPayload : CreateSelfTestResultPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a timestamped message that self-test's result, as the frames per second of the fastest step passed, the frames dropped, the 1 ms tick overruns and the byte period of the fastest step passed in microseconds.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId0PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the SelfTestResult register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.SelfTestResult.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.
     /// </summary>
-    [DisplayName("MatchTagId1PulseWidthPayload")]
-    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateMatchTagId1PulseWidthPayload
+    [DisplayName("ReaderBaudRatePayload")]
+    [Description("Creates a message payload that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.")]
+    public partial class CreateReaderBaudRatePayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Gets or sets the value that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.
         /// </summary>
-        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-        public ushort MatchTagId1PulseWidth { get; set; }
+        [Description("The value that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.")]
+        public BaudRate ReaderBaudRate { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId1PulseWidth register.
+        /// Creates a message payload for the ReaderBaudRate register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public BaudRate GetPayload()
         {
-            return MatchTagId1PulseWidth;
+            return ReaderBaudRate;
         }
 
         /// <summary>
-        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a message that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId1PulseWidth register.</returns>
+        /// <returns>A new message for the ReaderBaudRate register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId1PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.ReaderBaudRate.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId1PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateTimestampedMatchTagId1PulseWidthPayload : CreateMatchTagId1PulseWidthPayload
+    [DisplayName("TimestampedReaderBaudRatePayload")]
+    [Description("Creates a timestamped message payload that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.")]
+    public partial class CreateTimestampedReaderBaudRatePayload : CreateReaderBaudRatePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a timestamped message that baud rate of the reader modules' output. With the ASCII interface the frame timeout follows it, Wiegand has its own. Kept on the configuration image.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId1PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the ReaderBaudRate register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId1PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.ReaderBaudRate.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.
     /// </summary>
-    [DisplayName("MatchTagId2PulseWidthPayload")]
-    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateMatchTagId2PulseWidthPayload
+    [DisplayName("FrameTimingPayload")]
+    [Description("Creates a message payload that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.")]
+    public partial class CreateFrameTimingPayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Gets or sets the value that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.
         /// </summary>
-        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-        public ushort MatchTagId2PulseWidth { get; set; }
+        [Description("The value that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.")]
+        public ushort[] FrameTiming { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId2PulseWidth register.
+        /// Creates a message payload for the FrameTiming register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return MatchTagId2PulseWidth;
+            return FrameTiming;
         }
 
         /// <summary>
-        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a message that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId2PulseWidth register.</returns>
+        /// <returns>A new message for the FrameTiming register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId2PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.FrameTiming.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId2PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateTimestampedMatchTagId2PulseWidthPayload : CreateMatchTagId2PulseWidthPayload
+    [DisplayName("TimestampedFrameTimingPayload")]
+    [Description("Creates a timestamped message payload that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.")]
+    public partial class CreateTimestampedFrameTimingPayload : CreateFrameTimingPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a timestamped message that learned timing of the first reader's frames, as the average gap between the bytes of a frame and the frame timeout in use, both in microseconds, followed by the frame errors that made the timeout longer. The timeout starts at the baud rate's, about 5 bytes, and shrinks to 3 times the gap, or is fixed at 5 ms with Wiegand. Any write restarts the learning.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId2PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the FrameTiming register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId2PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.FrameTiming.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.
     /// </summary>
-    [DisplayName("MatchTagId3PulseWidthPayload")]
-    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateMatchTagId3PulseWidthPayload
+    [DisplayName("UserPatternPayload")]
+    [Description("Creates a message payload that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.")]
+    public partial class CreateUserPatternPayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Gets or sets the value that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.
         /// </summary>
-        [Description("The value that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-        public ushort MatchTagId3PulseWidth { get; set; }
+        [Description("The value that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.")]
+        public byte[] UserPattern { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MatchTagId3PulseWidth register.
+        /// Creates a message payload for the UserPattern register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte[] GetPayload()
         {
-            return MatchTagId3PulseWidth;
+            return UserPattern;
         }
 
         /// <summary>
-        /// Creates a message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a message that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MatchTagId3PulseWidth register.</returns>
+        /// <returns>A new message for the UserPattern register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId3PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.UserPattern.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+    /// that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.
     /// </summary>
-    [DisplayName("TimestampedMatchTagId3PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if the corresponding tag is detected.")]
-    public partial class CreateTimestampedMatchTagId3PulseWidthPayload : CreateMatchTagId3PulseWidthPayload
+    [DisplayName("TimestampedUserPatternPayload")]
+    [Description("Creates a timestamped message payload that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.")]
+    public partial class CreateTimestampedUserPatternPayload : CreateUserPatternPayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if the corresponding tag is detected.
+        /// Creates a timestamped message that the user's notification pattern of 8 steps, played by the notifications that select pattern 5. Each step is the output, with the tone's index on bits 0 to 3 (0 is silent, 1 to 15 are 400 Hz to 10 KHz in thirds of an octave) and the top and bottom LEDs on bits 4 and 5, followed by the duration in units of 10 ms. A step with duration 0 ends the pattern. Empty by default and not kept on the configuration image.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MatchTagId3PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the UserPattern register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.MatchTagId3PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.UserPattern.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that the time the digital output pin will stay on (ms) if any tag is detected.
+    /// that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.
     /// </summary>
-    [DisplayName("AnyTagIdPulseWidthPayload")]
-    [Description("Creates a message payload that the time the digital output pin will stay on (ms) if any tag is detected.")]
-    public partial class CreateAnyTagIdPulseWidthPayload
+    [DisplayName("StackFreePayload")]
+    [Description("Creates a message payload that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.")]
+    public partial class CreateStackFreePayload
     {
         /// <summary>
-        /// Gets or sets the value that the time the digital output pin will stay on (ms) if any tag is detected.
+        /// Gets or sets the value that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.
         /// </summary>
-        [Description("The value that the time the digital output pin will stay on (ms) if any tag is detected.")]
-        public ushort AnyTagIdPulseWidth { get; set; }
+        [Description("The value that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.")]
+        public ushort StackFree { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the AnyTagIdPulseWidth register.
+        /// Creates a message payload for the StackFree register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return AnyTagIdPulseWidth;
+            return StackFree;
         }
 
         /// <summary>
-        /// Creates a message that the time the digital output pin will stay on (ms) if any tag is detected.
+        /// Creates a message that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the AnyTagIdPulseWidth register.</returns>
+        /// <returns>A new message for the StackFree register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.AnyTagIdPulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.StackFree.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that the time the digital output pin will stay on (ms) if any tag is detected.
+    /// that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.
     /// </summary>
-    [DisplayName("TimestampedAnyTagIdPulseWidthPayload")]
-    [Description("Creates a timestamped message payload that the time the digital output pin will stay on (ms) if any tag is detected.")]
-    public partial class CreateTimestampedAnyTagIdPulseWidthPayload : CreateAnyTagIdPulseWidthPayload
+    [DisplayName("TimestampedStackFreePayload")]
+    [Description("Creates a timestamped message payload that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.")]
+    public partial class CreateTimestampedStackFreePayload : CreateStackFreePayload
     {
         /// <summary>
-        /// Creates a timestamped message that the time the digital output pin will stay on (ms) if any tag is detected.
+        /// Creates a timestamped message that the bytes of SRAM above the application's variables that the stack never reached since the last reset. Close to 0 means the stack almost ran into the variables.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the AnyTagIdPulseWidth register.</returns>
+        /// <returns>A new timestamped message for the StackFree register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.AnyTagIdPulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.StackFree.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that triggers the digital output pin for the specified duration (ms).
+    /// that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.
     /// </summary>
-    [DisplayName("DO0PulseWidthPayload")]
-    [Description("Creates a message payload that triggers the digital output pin for the specified duration (ms).")]
-    public partial class CreateDO0PulseWidthPayload
+    [DisplayName("HandlerTimesPayload")]
+    [Description("Creates a message payload that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.")]
+    public partial class CreateHandlerTimesPayload
     {
         /// <summary>
-        /// Gets or sets the value that triggers the digital output pin for the specified duration (ms).
+        /// Gets or sets the value that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.
         /// </summary>
-        [Description("The value that triggers the digital output pin for the specified duration (ms).")]
-        public ushort DO0PulseWidth { get; set; }
+        [Description("The value that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.")]
+        public ushort[] HandlerTimes { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0PulseWidth register.
+        /// Creates a message payload for the HandlerTimes register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return DO0PulseWidth;
+            return HandlerTimes;
         }
 
         /// <summary>
-        /// Creates a message that triggers the digital output pin for the specified duration (ms).
+        /// Creates a message that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        /// <returns>A new message for the HandlerTimes register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.RfidReader.DO0PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.RfidReader.HandlerTimes.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that triggers the digital output pin for the specified duration (ms).
+    /// that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.
     /// </summary>
-    [DisplayName("TimestampedDO0PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that triggers the digital output pin for the specified duration (ms).")]
-    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    [DisplayName("TimestampedHandlerTimesPayload")]
+    [Description("Creates a timestamped message payload that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.")]
+    public partial class CreateTimestampedHandlerTimesPayload : CreateHandlerTimesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that triggers the digital output pin for the specified duration (ms).
+        /// Creates a timestamped message that the longest time taken by the HIGH, MED and LOW level handlers since the last reset, in 0.25 us. Each time includes the higher levels that preempted the handler but not its entry and exit (~1 us). Only updated while Out0Gate is disabled, as both use the same timer. Any write resets the times.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the HandlerTimes register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.RfidReader.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.RfidReader.HandlerTimes.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// The available hardware notifications.
+    /// The available hardware notifications. Bits 4 to 6 select a pattern that replaces the other bits, unless it's empty: 1 a 2 KHz beep, 2 two short beeps, 3 a rising sequence, 4 a long 800 Hz beep, 5 UserPattern.
     /// </summary>
     [Flags]
     public enum HardwareNotifications : byte
@@ -3544,6 +9514,83 @@ namespace Harp.RfidReader
         BottomLed = 0x4
     }
 
+    /// <summary>
+    /// The detection log configuration.
+    /// </summary>
+    [Flags]
+    public enum DetectionLogOptions : byte
+    {
+        None = 0x0,
+        Enable = 0x1
+    }
+
+    /// <summary>
+    /// The configuration image commands.
+    /// </summary>
+    [Flags]
+    public enum ConfigImageCommands : byte
+    {
+        None = 0x0,
+        Save = 0x1,
+        Erase = 0x2
+    }
+
+    /// <summary>
+    /// The frames published as raw frames.
+    /// </summary>
+    [Flags]
+    public enum RawFrameOptions : byte
+    {
+        None = 0x0,
+        Undecoded = 0x1,
+        All = 0x2
+    }
+
+    /// <summary>
+    /// The frame formats decoded from the reader module.
+    /// </summary>
+    [Flags]
+    public enum TagProtocols : byte
+    {
+        None = 0x0,
+        EM4100 = 0x1,
+        FdxB = 0x2
+    }
+
+    /// <summary>
+    /// The detection events configuration.
+    /// </summary>
+    [Flags]
+    public enum EventOptions : byte
+    {
+        None = 0x0,
+        MatchIndex = 0x1,
+        Unmatched = 0x2,
+        PresenceQuality = 0x4,
+        TagPresent = 0x8
+    }
+
+    /// <summary>
+    /// The statistics configuration.
+    /// </summary>
+    [Flags]
+    public enum StatisticsOptions : byte
+    {
+        None = 0x0,
+        Enable = 0x1
+    }
+
+    /// <summary>
+    /// The gated digital output configuration.
+    /// </summary>
+    [Flags]
+    public enum Out0GateOptions : byte
+    {
+        None = 0x0,
+        Enable = 0x1,
+        FollowTagInRange = 0x2
+    }
+
     /// <summary>
     /// The state of the digital output pin.
     /// </summary>
@@ -3552,4 +9599,25 @@ namespace Harp.RfidReader
         Low = 0,
         High = 1
     }
+
+    /// <summary>
+    /// The output of the reader module.
+    /// </summary>
+    public enum ReaderOutput : byte
+    {
+        Ascii = 0,
+        Wiegand = 1
+    }
+
+    /// <summary>
+    /// The baud rate of the reader modules' output.
+    /// </summary>
+    public enum BaudRate : byte
+    {
+        Baud9600 = 0,
+        Baud19200 = 1,
+        Baud38400 = 2,
+        Baud57600 = 3,
+        Baud115200 = 4
+    }
 }
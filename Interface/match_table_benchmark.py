@@ -0,0 +1,159 @@
+"""Compares uploading matching IDs through MatchTable and TagMatchx.
+
+MatchTable takes MATCH_TABLE_SIZE entries (ID, pulse width, notifications
+and limits) per Harp write. The TagMatchx registers take one write for the
+ID and another for its pulse width. The device keeps only MATCH_TABLE_SIZE
+table entries and 4 TagMatchx IDs, the EEPROM and the SRAM have no room for
+more, so a number of tags beyond that is the traffic of reconfiguring
+several devices, or the same one several times.
+
+    python match_table_benchmark.py                     models the writes
+    python match_table_benchmark.py --tags 64           for 64 tags, 256 by default
+    python match_table_benchmark.py --port COM3         times them on a device
+
+The model counts the bytes of each write and its reply at --baud (1 Mbps
+by default) plus --round-trip ms per write (1 by default), as a host that
+waits for each reply. On a device every write is sent and its reply read
+before the next one, the entries cycle through its registers. The device
+is left with the last entries written, pyserial is needed.
+"""
+
+import os
+import re
+import struct
+import sys
+import time
+
+import yaml
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FIRMWARE = os.path.join(ROOT, 'Firmware', 'RfidReader')
+
+ENTRY_FORMAT = '<QHBHBH'    # match_entry_t
+PAYLOAD_TYPES = {'U8': 0x01, 'U16': 0x02, 'U32': 0x04, 'U64': 0x08}
+FORMATS = {'U8': 'B', 'U16': 'H', 'U32': 'I', 'U64': 'Q'}
+WRITE = 2
+ERROR_bm = 0x08
+TIMESTAMP_SIZE = 6
+TAG_MATCH_COUNT = 4
+
+
+def fail(message):
+    sys.exit('match_table_benchmark.py: ' + message)
+
+
+def read_defines(name):
+    defines = {}
+    with open(os.path.join(FIRMWARE, name)) as f:
+        for line in f:
+            match = re.match(r'#define (\w+)\s+([^/]+)', line)
+            if match:
+                try:
+                    defines[match.group(1)] = eval(match.group(2), {}, defines)
+                except (NameError, SyntaxError):
+                    pass
+    return defines
+
+
+MATCH_TABLE_SIZE = read_defines('app.h')['MATCH_TABLE_SIZE']
+
+with open(os.path.join(ROOT, 'device.yml')) as f:
+    REGISTERS = yaml.safe_load(f)['registers']
+
+if REGISTERS['MatchTable']['length'] != struct.calcsize(ENTRY_FORMAT) * MATCH_TABLE_SIZE:
+    fail('MatchTable on device.yml is not MATCH_TABLE_SIZE entries of %d bytes' % struct.calcsize(ENTRY_FORMAT))
+
+
+def write_message(name, values):
+    """A Harp write without timestamp, its reply carries one."""
+    register = REGISTERS[name]
+    payload = struct.pack('<%d%s' % (len(values), FORMATS[register['type']]), *values)
+    message = bytes([WRITE, 4 + len(payload), register['address'], 255, PAYLOAD_TYPES[register['type']]]) + payload
+    return message + bytes([sum(message) & 0xFF])
+
+
+def reply_size(message):
+    return len(message) + TIMESTAMP_SIZE
+
+
+def tag_ids(n_tags):
+    return [0x0100000000 + i for i in range(1, n_tags + 1)]
+
+
+def match_table_writes(ids):
+    """MATCH_TABLE_SIZE entries per write, the last one padded with unused entries."""
+    entries = [(tag_id, 500, 0x01, 0, 0, 0) for tag_id in ids]
+    entries += [(0, 0, 0, 0, 0, 0)] * (-len(entries) % MATCH_TABLE_SIZE)
+    writes = []
+    for i in range(0, len(entries), MATCH_TABLE_SIZE):
+        payload = b''.join(struct.pack(ENTRY_FORMAT, *e) for e in entries[i:i + MATCH_TABLE_SIZE])
+        writes.append(write_message('MatchTable', list(payload)))
+    return writes
+
+
+def tag_match_writes(ids):
+    """The ID and its pulse width, the notifications can't be set per ID."""
+    writes = []
+    for i, tag_id in enumerate(ids):
+        slot = i % TAG_MATCH_COUNT
+        writes.append(write_message('MatchTagId%d' % slot, [tag_id]))
+        writes.append(write_message('MatchTagId%dPulseWidth' % slot, [500]))
+    return writes
+
+
+def model(writes, baud, round_trip):
+    n_bytes = sum(len(w) + reply_size(w) for w in writes)
+    return n_bytes, n_bytes * 10 / baud * 1000 + len(writes) * round_trip
+
+
+def measure(writes, port):
+    start = time.perf_counter()
+    for message in writes:
+        port.write(message)
+        header = port.read(2)
+        if len(header) < 2:
+            fail('no reply from the device')
+        reply = header + port.read(header[1])
+        if reply[0] & ERROR_bm:
+            fail('the device replied with an error to register %d' % message[2])
+    return (time.perf_counter() - start) * 1000
+
+
+def option(args, name, default, kind):
+    if name not in args:
+        return default
+    try:
+        return kind(args[args.index(name) + 1])
+    except (IndexError, ValueError):
+        fail('%s takes a value' % name)
+
+
+def main():
+    args = sys.argv[1:]
+    n_tags = option(args, '--tags', 256, int)
+    baud = option(args, '--baud', 1000000, int)
+    round_trip = option(args, '--round-trip', 1.0, float)
+    port_name = option(args, '--port', None, str)
+
+    ids = tag_ids(n_tags)
+    paths = (('MatchTable', match_table_writes(ids)), ('TagMatchx', tag_match_writes(ids)))
+
+    port = None
+    if port_name:
+        import serial
+        port = serial.Serial(port_name, baud, timeout=1)
+
+    print('%d tags, the device keeps %d table entries and %d TagMatchx IDs' % (n_tags, MATCH_TABLE_SIZE, TAG_MATCH_COUNT))
+    print('%-12s %8s %8s %12s' % ('', 'writes', 'bytes', 'time (ms)'))
+    for name, writes in paths:
+        n_bytes, elapsed = model(writes, baud, round_trip)
+        if port:
+            elapsed = measure(writes, port)
+        print('%-12s %8d %8d %12.1f' % (name, len(writes), n_bytes, elapsed))
+
+    if port:
+        port.close()
+
+
+if __name__ == '__main__':
+    main()
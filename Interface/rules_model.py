@@ -0,0 +1,202 @@
+"""Runs the firmware's rules (REG_RULES) on the host.
+
+A model of Firmware/RfidReader/rules.c, to try a set of rules on a list of
+detections before writing it to the device. The rules' layout, the bits
+and the sizes are read from rules.h and app.h, so they follow the
+firmware's.
+
+    python rules_model.py scenario.yml          prints each detection's actions
+    python rules_model.py scenario.yml --pack   prints the REG_RULES payload
+
+The scenario lists the rules and the detections, in time order:
+
+    rules:
+      - conditions: [match_index, absence]
+        actions: [out0]
+        match_indexes: [4]
+        min_absence: 60
+        out0_period: 500
+    detections:
+      - {second: 100, match_index: 4}
+      - {second: 130, match_index: 4, in_range: true}
+
+A detection without match_index has no matching ID, and null on a rule's
+match_indexes stands for those. The fields left out of a rule are 0.
+"""
+
+import os
+import re
+import struct
+import sys
+
+import yaml
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FIRMWARE = os.path.join(ROOT, 'Firmware', 'RfidReader')
+
+RULE_FORMAT = '<BBHIHHB'
+RULE_FIELDS = ('flags', 'match_indexes', 'min_absence', 'window_start',
+               'window_length', 'out0_period', 'notifications')
+
+
+def fail(message):
+    sys.exit('rules_model.py: ' + message)
+
+
+def read_defines(name):
+    defines = {}
+    with open(os.path.join(FIRMWARE, name)) as f:
+        for line in f:
+            match = re.match(r'#define (\w+)\s+([^/]+)', line)
+            if match:
+                try:
+                    defines[match.group(1)] = eval(match.group(2), {}, defines)
+                except (NameError, SyntaxError):
+                    pass
+    return defines
+
+
+FW = read_defines('app.h')
+FW.update(read_defines('rules.h'))
+
+CONDITIONS = {
+    'match_index': FW['RULE_MATCH_INDEX_bm'],
+    'absence': FW['RULE_ABSENCE_bm'],
+    'in_range': FW['RULE_IN_RANGE_bm'],
+    'not_in_range': FW['RULE_NOT_IN_RANGE_bm'],
+    'window': FW['RULE_WINDOW_bm'],
+}
+ACTIONS = {
+    'out0': FW['RULE_OUT0_bm'],
+    'notify': FW['RULE_NOTIFY_bm'],
+    'suppress': FW['RULE_SUPPRESS_bm'],
+}
+N_INDEXES = FW['MATCH_TABLE_FIRST_INDEX'] + FW['MATCH_TABLE_SIZE']
+
+with open(os.path.join(ROOT, 'device.yml')) as f:
+    if yaml.safe_load(f)['registers']['Rules']['length'] != struct.calcsize(RULE_FORMAT) * FW['RULES_SIZE']:
+        fail('the rules on device.yml are not RULES_SIZE rules of %d bytes' % struct.calcsize(RULE_FORMAT))
+
+
+def bits(names, table, what):
+    value = 0
+    for name in names or []:
+        if name not in table:
+            fail('unknown %s %r' % (what, name))
+        value |= table[name]
+    return value
+
+
+def rule_from_yaml(rule):
+    indexes = 0
+    for index in rule.get('match_indexes', []):
+        indexes |= FW['RULE_NO_MATCH'] if index is None else 1 << index
+    return {
+        'flags': bits(rule.get('conditions'), CONDITIONS, 'condition')
+                 | bits(rule.get('actions'), ACTIONS, 'action'),
+        'match_indexes': indexes,
+        'min_absence': rule.get('min_absence', 0),
+        'window_start': rule.get('window_start', 0),
+        'window_length': rule.get('window_length', 0),
+        'out0_period': rule.get('out0_period', 0),
+        'notifications': rule.get('notifications', 0),
+    }
+
+
+def pack(rules):
+    if len(rules) > FW['RULES_SIZE']:
+        fail('the device keeps %d rules' % FW['RULES_SIZE'])
+    empty = dict.fromkeys(RULE_FIELDS, 0)
+    rules = rules + [empty] * (FW['RULES_SIZE'] - len(rules))
+    return b''.join(struct.pack(RULE_FORMAT, *(r[f] for f in RULE_FIELDS)) for r in rules)
+
+
+class Rules:
+    """rules.c, with the detections' Harp second and TAG_IN_RANGE given."""
+
+    def __init__(self, payload):
+        size = struct.calcsize(RULE_FORMAT)
+        self.rules = [dict(zip(RULE_FIELDS, struct.unpack_from(RULE_FORMAT, payload, i * size)))
+                      for i in range(FW['RULES_SIZE'])]
+        self.visit_age = [0] * N_INDEXES
+        self.second = None
+
+    def new_second(self, second):
+        new_minute = second % 60 == 0
+        for i, age in enumerate(self.visit_age):
+            if age and age < FW['VISIT_AGE_MAX'] and (age <= FW['VISIT_AGE_SECONDS'] or new_minute):
+                self.visit_age[i] = age + 1
+
+    def advance(self, second):
+        if self.second is not None:
+            # Every age saturates within 2 h 20 min
+            for s in range(self.second + 1, min(second, self.second + 8400) + 1):
+                self.new_second(s)
+            if second > self.second + 8400:
+                self.visit_age = [FW['VISIT_AGE_MAX'] if a else 0 for a in self.visit_age]
+        self.second = second
+
+    def is_absent(self, match_index, min_absence):
+        age = self.visit_age[match_index]
+        if age == 0 or age == FW['VISIT_AGE_MAX']:
+            return True
+        if age <= FW['VISIT_AGE_SECONDS'] + 1:
+            return age - 1 >= min_absence
+        return (age - FW['VISIT_AGE_SECONDS']) * 60 >= min_absence
+
+    def is_met(self, rule, match_index, in_range):
+        conditions = rule['flags']
+        index_bit = FW['RULE_NO_MATCH'] if match_index is None else 1 << match_index
+        if conditions & FW['RULE_MATCH_INDEX_bm'] and not rule['match_indexes'] & index_bit:
+            return False
+        if conditions & FW['RULE_ABSENCE_bm'] and match_index is not None:
+            if not self.is_absent(match_index, rule['min_absence']):
+                return False
+        if conditions & FW['RULE_IN_RANGE_bm'] and not in_range:
+            return False
+        if conditions & FW['RULE_NOT_IN_RANGE_bm'] and in_range:
+            return False
+        if conditions & FW['RULE_WINDOW_bm']:
+            if (self.second - rule['window_start']) % 2**32 >= rule['window_length']:
+                return False
+        return True
+
+    def apply(self, second, match_index=None, in_range=False, out0_period=0, notifications=0):
+        """Returns the actions, the OUT0 period and the notifications."""
+        self.advance(second)
+        actions = 0
+        for rule in self.rules:
+            if rule['flags'] & FW['RULE_ACTIONS_gm'] and self.is_met(rule, match_index, in_range):
+                actions = rule['flags'] & FW['RULE_ACTIONS_gm']
+                if actions & FW['RULE_OUT0_bm']:
+                    out0_period = rule['out0_period']
+                if actions & FW['RULE_NOTIFY_bm']:
+                    notifications = rule['notifications']
+                break
+        if match_index is not None:
+            self.visit_age[match_index] = 1
+        return actions, out0_period, notifications
+
+
+def main():
+    args = sys.argv[1:]
+    if not args:
+        fail('usage: rules_model.py scenario.yml [--pack]')
+    with open(args[0]) as f:
+        scenario = yaml.safe_load(f)
+    payload = pack([rule_from_yaml(r) for r in scenario.get('rules', [])])
+    if '--pack' in args:
+        print(payload.hex())
+        return
+    model = Rules(payload)
+    names = {v: k for k, v in ACTIONS.items()}
+    for detection in scenario.get('detections', []):
+        actions, out0_period, notifications = model.apply(**detection)
+        applied = [names[b] for b in sorted(names) if actions & b] or ['none']
+        print('%10d  index %-4s  %-16s  OUT0 %5d ms  notifications 0x%02X' % (
+            detection['second'], detection.get('match_index', '-'),
+            ','.join(applied), out0_period, notifications))
+
+
+if __name__ == '__main__':
+    main()